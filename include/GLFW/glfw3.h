@@ -109,6 +109,10 @@ extern "C" {
  #include <stddef.h>
 #endif
 
+/* Frame timing uses fixed-width types for the UST, MSC and SBC counters.
+ */
+#include <stdint.h>
+
 /* Include the chosen client API headers.
  */
 #if defined(__APPLE_CC__)
@@ -390,6 +394,12 @@ extern "C" {
 #define GLFW_KEY_MENU               348
 #define GLFW_KEY_LAST               GLFW_KEY_MENU
 
+/*! @brief The number of 32-bit words in a keyboard state bitset.
+ *
+ *  @sa glfwGetKeyboardState
+ */
+#define GLFW_KEYBOARD_STATE_WORDS   ((GLFW_KEY_LAST + 32) / 32)
+
 /*! @} */
 
 /*! @defgroup mods Modifier key flags
@@ -596,6 +606,7 @@ extern "C" {
 #define GLFW_DECORATED              0x00020005
 #define GLFW_AUTO_ICONIFY           0x00020006
 #define GLFW_FLOATING               0x00020007
+#define GLFW_OFFSCREEN              0x00020008
 
 #define GLFW_RED_BITS               0x00021001
 #define GLFW_GREEN_BITS             0x00021002
@@ -638,6 +649,7 @@ extern "C" {
 #define GLFW_CURSOR                 0x00033001
 #define GLFW_STICKY_KEYS            0x00033002
 #define GLFW_STICKY_MOUSE_BUTTONS   0x00033003
+#define GLFW_COALESCE_CURSOR_MOTION 0x00033004
 
 #define GLFW_CURSOR_NORMAL          0x00034001
 #define GLFW_CURSOR_HIDDEN          0x00034002
@@ -686,6 +698,41 @@ extern "C" {
 #define GLFW_VRESIZE_CURSOR         0x00036006
 /*! @} */
 
+#define GLFW_JOYSTICK_AXIS          0x00037001
+#define GLFW_JOYSTICK_BUTTON        0x00037002
+
+/*! @addtogroup window
+ *  @{ */
+#define GLFW_EVENT_KEY              0x00038001
+#define GLFW_EVENT_CHAR             0x00038002
+#define GLFW_EVENT_MOUSE_BUTTON     0x00038003
+#define GLFW_EVENT_CURSOR_POS       0x00038004
+#define GLFW_EVENT_CURSOR_ENTER     0x00038005
+#define GLFW_EVENT_SCROLL           0x00038006
+#define GLFW_EVENT_WINDOW_POS       0x00038007
+#define GLFW_EVENT_WINDOW_SIZE      0x00038008
+#define GLFW_EVENT_WINDOW_CLOSE     0x00038009
+#define GLFW_EVENT_WINDOW_REFRESH   0x0003800A
+#define GLFW_EVENT_WINDOW_FOCUS     0x0003800B
+#define GLFW_EVENT_WINDOW_ICONIFY   0x0003800C
+#define GLFW_EVENT_FRAMEBUFFER_SIZE 0x0003800D
+/*! @} */
+
+/*! @addtogroup window
+ *  @{ */
+/*! @brief The file descriptor can be read without blocking.
+ */
+#define GLFW_FD_READABLE            0x0001
+/*! @brief The file descriptor can be written without blocking.
+ */
+#define GLFW_FD_WRITABLE            0x0002
+/*! @brief An error or hangup occurred on the file descriptor.
+ *
+ *  This is always reported and need not be requested.
+ */
+#define GLFW_FD_ERROR               0x0004
+/*! @} */
+
 #define GLFW_CONNECTED              0x00040001
 #define GLFW_DISCONNECTED           0x00040002
 
@@ -729,6 +776,14 @@ typedef struct GLFWwindow GLFWwindow;
  */
 typedef struct GLFWcursor GLFWcursor;
 
+/*! @brief Opaque context pool object.
+ *
+ *  Opaque context pool object.
+ *
+ *  @ingroup context
+ */
+typedef struct GLFWcontextpool GLFWcontextpool;
+
 /*! @brief The function signature for error callbacks.
  *
  *  This is the function signature for error callback functions.
@@ -961,6 +1016,36 @@ typedef void (* GLFWcharmodsfun)(GLFWwindow*,unsigned int,int);
  */
 typedef void (* GLFWdropfun)(GLFWwindow*,int,const char**);
 
+/*! @brief The function signature for clipboard string callbacks.
+ *
+ *  This is the function signature for clipboard string callback functions.
+ *
+ *  @param[in] window The window that requested the clipboard contents.
+ *  @param[in] string The contents of the clipboard as a UTF-8 encoded string,
+ *  or `NULL` if the request failed or timed out.
+ *
+ *  @par Pointer Lifetime
+ *  The string is only valid until the callback returns.
+ *
+ *  @sa glfwRequestClipboardString
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWclipboardfun)(GLFWwindow*,const char*);
+
+/*! @brief The function signature for clipboard data free functions.
+ *
+ *  This is the function signature for the functions that free data given to
+ *  @ref glfwSetClipboardData once GLFW no longer needs it.
+ *
+ *  @param[in] data The data given to @ref glfwSetClipboardData.
+ *
+ *  @sa glfwSetClipboardData
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWclipboardfreefun)(void*);
+
 /*! @brief The function signature for monitor configuration callbacks.
  *
  *  This is the function signature for monitor configuration callback functions.
@@ -974,6 +1059,32 @@ typedef void (* GLFWdropfun)(GLFWwindow*,int,const char**);
  */
 typedef void (* GLFWmonitorfun)(GLFWmonitor*,int);
 
+/*! @brief The function signature for file descriptor callbacks.
+ *
+ *  This is the function signature for file descriptor callback functions.
+ *
+ *  @param[in] fd The file descriptor that is ready.
+ *  @param[in] events One or more of `GLFW_FD_READABLE`, `GLFW_FD_WRITABLE` and
+ *  `GLFW_FD_ERROR`.
+ *
+ *  @sa glfwSetFileDescriptorCallback
+ *
+ *  @ingroup window
+ */
+typedef void (* GLFWfdfun)(int,int);
+
+/*! @brief The function signature for user event callbacks.
+ *
+ *  This is the function signature for user event callback functions.
+ *
+ *  @param[in] payload The pointer passed to @ref glfwPostUserEvent.
+ *
+ *  @sa glfwSetUserEventCallback
+ *
+ *  @ingroup window
+ */
+typedef void (* GLFWusereventfun)(void*);
+
 /*! @brief Video mode type.
  *
  *  This describes a single video mode.
@@ -1041,6 +1152,168 @@ typedef struct GLFWimage
     unsigned char* pixels;
 } GLFWimage;
 
+/*! @brief Joystick input event.
+ *
+ *  This describes a single change of a joystick axis or button.
+ *
+ *  @sa glfwGetJoystickEvents
+ *
+ *  @ingroup input
+ */
+typedef struct GLFWjoystickevent
+{
+    /*! The time, on the GLFW timer, at which the change was sampled.
+     */
+    double time;
+    /*! Either `GLFW_JOYSTICK_AXIS` or `GLFW_JOYSTICK_BUTTON`.
+     */
+    int type;
+    /*! The index of the axis or button in the arrays returned by @ref
+     *  glfwGetJoystickAxes and @ref glfwGetJoystickButtons.
+     */
+    int index;
+    /*! The new axis value, or `GLFW_PRESS` or `GLFW_RELEASE` for buttons.
+     */
+    float value;
+} GLFWjoystickevent;
+
+/*! @brief Frame timing.
+ *
+ *  This describes the most recently completed buffer swap of a window, as
+ *  reported by the context creation API.
+ *
+ *  @sa @ref buffer_swap_timing
+ *  @sa glfwGetFrameTiming
+ *
+ *  @ingroup context
+ */
+typedef struct GLFWframetiming
+{
+    /*! The unadjusted system time, in microseconds, at which the swap was
+     *  presented.  Its epoch is platform-specific.
+     */
+    uint64_t ust;
+    /*! The media stream counter, i.e. the number of vertical retraces of the
+     *  display, at which the swap was presented.
+     */
+    uint64_t msc;
+    /*! The swap buffer counter, i.e. the number of completed swaps.
+     */
+    uint64_t sbc;
+    /*! The time, on the GLFW timer, at which the swap was presented, or zero
+     *  if the system time of the platform cannot be related to it.
+     */
+    double presentTime;
+    /*! The time, in seconds, between vertical retraces of the display, or zero
+     *  if it is not yet known.
+     */
+    double refreshPeriod;
+    /*! The total number of vertical retraces since the first reported swap
+     *  that passed without a new frame being presented when one was due.
+     */
+    int missedFrames;
+} GLFWframetiming;
+
+/*! @brief Frame pacing statistics.
+ *
+ *  This describes the frames paced by @ref glfwWaitForFrame since the window
+ *  was created or its statistics were last reset.
+ *
+ *  @sa @ref buffer_swap_pacing
+ *  @sa glfwGetFrameStatistics
+ *
+ *  @ingroup context
+ */
+typedef struct GLFWframestats
+{
+    /*! The number of frame times measured, i.e. one less than the number of
+     *  paced frames.
+     */
+    int frameCount;
+    /*! The number of retraces skipped because a frame overran its budget.
+     */
+    int missedDeadlines;
+    /*! The mean time, in seconds, between successive wakeups.
+     */
+    double meanFrameTime;
+    /*! The shortest time, in seconds, between successive wakeups.
+     */
+    double minFrameTime;
+    /*! The longest time, in seconds, between successive wakeups.
+     */
+    double maxFrameTime;
+    /*! The standard deviation, in seconds, of the time between wakeups.
+     */
+    double frameTimeDeviation;
+    /*! The mean time, in seconds, by which wakeups were later than their
+     *  deadline.
+     */
+    double meanWakeLatency;
+    /*! The largest time, in seconds, by which a wakeup was later than its
+     *  deadline.
+     */
+    double maxWakeLatency;
+} GLFWframestats;
+
+/*! @brief Event record.
+ *
+ *  This describes a single window or input event written to the
+ *  [event buffer](@ref events_buffer).  Only the member of `data` matching the
+ *  type of the event is valid.
+ *
+ *  @sa @ref events_buffer
+ *  @sa glfwSetEventBuffer
+ *
+ *  @ingroup window
+ */
+typedef struct GLFWevent
+{
+    /*! The type of the event, for example `GLFW_EVENT_KEY`.
+     */
+    int type;
+    /*! The window that received the event.  It may have been destroyed since
+     *  the event was written.
+     */
+    GLFWwindow* window;
+    /*! The time, on the GLFW timer, at which the event was received.
+     */
+    double time;
+    /*! The event-specific data, with the same meaning as the arguments of the
+     *  matching callback.
+     */
+    union
+    {
+        /*! For `GLFW_EVENT_KEY`.
+         */
+        struct { int key; int scancode; int action; int mods; } key;
+        /*! For `GLFW_EVENT_CHAR`.  The character would also have been passed
+         *  to the [character callback](@ref glfwSetCharCallback) if `plain`
+         *  is `GL_TRUE`.
+         */
+        struct { unsigned int codepoint; int mods; int plain; } character;
+        /*! For `GLFW_EVENT_MOUSE_BUTTON`.
+         */
+        struct { int button; int action; int mods; } mouseButton;
+        /*! For `GLFW_EVENT_CURSOR_POS`.
+         */
+        struct { double x; double y; } cursorPos;
+        /*! For `GLFW_EVENT_SCROLL`.
+         */
+        struct { double x; double y; } scroll;
+        /*! For `GLFW_EVENT_WINDOW_POS`.
+         */
+        struct { int x; int y; } pos;
+        /*! For `GLFW_EVENT_WINDOW_SIZE` and `GLFW_EVENT_FRAMEBUFFER_SIZE`.
+         */
+        struct { int width; int height; } size;
+        /*! For `GLFW_EVENT_CURSOR_ENTER`, `GLFW_EVENT_WINDOW_FOCUS` and
+         *  `GLFW_EVENT_WINDOW_ICONIFY`, whether the cursor entered, the window
+         *  was focused or the window was iconified.
+         */
+        int state;
+    } data;
+} GLFWevent;
+
 
 /*************************************************************************
  * GLFW API functions
@@ -1583,6 +1856,10 @@ GLFWAPI void glfwWindowHint(int target, int hint);
  *  The [swap interval](@ref buffer_swap) is not set during window creation and
  *  the initial value may vary depending on driver settings and defaults.
  *
+ *  If the [GLFW_OFFSCREEN](@ref window_hints_wnd) hint is set, only a context
+ *  is created.  Its default framebuffer, if any, has the requested size and
+ *  no window is shown.  Offscreen windows cannot be full screen.
+ *
  *  @param[in] width The desired width, in screen coordinates, of the window.
  *  This must be greater than zero.
  *  @param[in] height The desired height, in screen coordinates, of the window.
@@ -1624,6 +1901,9 @@ GLFWAPI void glfwWindowHint(int target, int hint);
  *  [High Resolution Guidelines for OS X](https://developer.apple.com/library/mac/documentation/GraphicsAnimation/Conceptual/HighResolutionOSX/Explained/Explained.html)
  *  in the Mac Developer Library.
  *
+ *  @remarks __Windows, OS X:__ Offscreen windows are not yet supported and
+ *  will fail with `GLFW_API_UNAVAILABLE`.
+ *
  *  @remarks __X11:__ There is no mechanism for setting the window icon yet.
  *
  *  @remarks __X11:__ Some window managers will not respect the placement of
@@ -1647,7 +1927,9 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height, const char* title, G
 /*! @brief Destroys the specified window and its context.
  *
  *  This function destroys the specified window and its context.  On calling
- *  this function, no further callbacks will be called for that window.
+ *  this function, no further callbacks will be called for that window.  Any
+ *  events for that window still in the [event buffer](@ref glfwSetEventBuffer)
+ *  are removed and no further events will be buffered for it.
  *
  *  If the context of the specified window is current on the main thread, it is
  *  detached before being destroyed.
@@ -2298,7 +2580,8 @@ GLFWAPI GLFWframebuffersizefun glfwSetFramebufferSizeCallback(GLFWwindow* window
  *  without going through the event queue, causing callbacks to be called
  *  outside of a call to one of the event processing functions.
  *
- *  Event processing is not required for joystick input to work.
+ *  On Linux, joystick state is also updated by this function.  On other
+ *  platforms, event processing is not required for joystick input to work.
  *
  *  @par Reentrancy
  *  This function may not be called from a callback.
@@ -2341,7 +2624,8 @@ GLFWAPI void glfwPollEvents(void);
  *  of threads in applications that do not create windows, use your threading
  *  library of choice.
  *
- *  Event processing is not required for joystick input to work.
+ *  On Linux, joystick state is also updated by this function.  On other
+ *  platforms, event processing is not required for joystick input to work.
  *
  *  @par Reentrancy
  *  This function may not be called from a callback.
@@ -2358,10 +2642,86 @@ GLFWAPI void glfwPollEvents(void);
  */
 GLFWAPI void glfwWaitEvents(void);
 
+/*! @brief Waits with timeout until events are queued and processes them.
+ *
+ *  This function puts the calling thread to sleep until at least one event is
+ *  available in the event queue, or until the specified timeout is reached.  If
+ *  one or more events are available, it behaves exactly like @ref
+ *  glfwPollEvents, i.e. the events in the queue are processed and the function
+ *  then returns immediately.  Processing events will cause the window and input
+ *  callbacks associated with those events to be called.
+ *
+ *  The timeout value must be a positive finite number or zero.  Timeouts too
+ *  long for the platform to represent are treated as waiting indefinitely.
+ *
+ *  Since not all events are associated with callbacks, this function may return
+ *  without a callback having been called even if you are monitoring all
+ *  callbacks.
+ *
+ *  On some platforms, a window move, resize or menu operation will cause event
+ *  processing to block.  This is due to how event processing is designed on
+ *  those platforms.  You can use the
+ *  [window refresh callback](@ref window_refresh) to redraw the contents of
+ *  your window when necessary during such operations.
+ *
+ *  On some platforms, certain callbacks may be called outside of a call to one
+ *  of the event processing functions.
+ *
+ *  Unlike @ref glfwWaitEvents, this function sleeps for the full timeout even if
+ *  no windows exist.
+ *
+ *  On Linux, joystick state is also updated by this function.  On other
+ *  platforms, event processing is not required for joystick input to work.
+ *
+ *  @param[in] timeout The maximum amount of time, in seconds, to wait.
+ *
+ *  @par Reentrancy
+ *  This function may not be called from a callback.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref events
+ *  @sa glfwWaitEvents
+ *  @sa glfwWaitEventsUntil
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwWaitEventsTimeout(double timeout);
+
+/*! @brief Waits until events are queued or a deadline passes and processes
+ *  them.
+ *
+ *  This function behaves like @ref glfwWaitEventsTimeout, except that it
+ *  waits until the specified time on the [GLFW timer](@ref time) rather than
+ *  for a relative amount of time.  If the time has already passed, it behaves
+ *  exactly like @ref glfwPollEvents.  The time must be a finite number.
+ *
+ *  @param[in] time The time, in seconds on the GLFW timer, to wait until.
+ *
+ *  @par Reentrancy
+ *  This function may not be called from a callback.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref events
+ *  @sa glfwWaitEventsTimeout
+ *  @sa glfwGetTime
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwWaitEventsUntil(double time);
+
 /*! @brief Posts an empty event to the event queue.
  *
  *  This function posts an empty event from the current thread to the event
- *  queue, causing @ref glfwWaitEvents to return.
+ *  queue, causing @ref glfwWaitEvents, @ref glfwWaitEventsTimeout or @ref
+ *  glfwWaitEventsUntil to return.
  *
  *  If no windows exist, this function returns immediately.  For synchronization
  *  of threads in applications that do not create windows, use your threading
@@ -2379,15 +2739,148 @@ GLFWAPI void glfwWaitEvents(void);
  */
 GLFWAPI void glfwPostEmptyEvent(void);
 
+/*! @brief Posts a user event to the event queue.
+ *
+ *  This function posts an event carrying the specified pointer from the
+ *  current thread to the main thread.  The pointer is passed to the
+ *  [user event callback](@ref glfwSetUserEventCallback) during the next event
+ *  processing, and a wait in @ref glfwWaitEvents, @ref glfwWaitEventsTimeout
+ *  or @ref glfwWaitEventsUntil is ended.
+ *
+ *  User events are delivered in the order they were posted.  Posting does not
+ *  take any lock or allocate memory, but the queue is bounded, so posting fails
+ *  if the main thread has fallen too far behind.
+ *
+ *  On X11 and Wayland, the main thread is woken without a window system
+ *  request and user events are delivered even if no windows exist.  On other
+ *  platforms, the main thread is woken as if by @ref glfwPostEmptyEvent,
+ *  which requires a window to exist.
+ *
+ *  @param[in] payload The pointer to pass to the user event callback.
+ *  @return `GL_TRUE` if the event was posted, or `GL_FALSE` if the queue was
+ *  full or an [error](@ref error_handling) occurred.
+ *
+ *  @par Thread Safety
+ *  This function may be called from any thread.
+ *
+ *  @sa @ref events_user
+ *  @sa glfwSetUserEventCallback
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup window
+ */
+GLFWAPI int glfwPostUserEvent(void* payload);
+
+/*! @brief Sets the user event callback.
+ *
+ *  This function sets the user event callback, which is called from event
+ *  processing on the main thread with the payload of every event posted with
+ *  @ref glfwPostUserEvent.  User events that arrive while no callback is set
+ *  are discarded.
+ *
+ *  @param[in] cbfun The new callback, or `NULL` to remove the currently set
+ *  callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or the
+ *  library had not been [initialized](@ref intro_init).
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref events_user
+ *  @sa glfwPostUserEvent
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup window
+ */
+GLFWAPI GLFWusereventfun glfwSetUserEventCallback(GLFWusereventfun cbfun);
+
+/*! @brief Sets the buffer that window and input events are written to.
+ *
+ *  This function sets the buffer that window and input events are written to
+ *  instead of being passed to callbacks, and returns the number of events that
+ *  were written to the previous buffer.  Each new buffer is filled from the
+ *  start, so passing the same buffer again empties it.
+ *
+ *  Events are written in the order they were received, as fixed-size records
+ *  with a timestamp, so that they can be handled in a single loop or passed to
+ *  another thread as a whole.  While no buffer is set, events are passed to
+ *  callbacks as usual.
+ *
+ *  Events that do not fit in the buffer, file drop events and events that are
+ *  not specific to a window are still passed to their callbacks.
+ *
+ *  @param[in] events The buffer to write events to, or `NULL` to pass events
+ *  to callbacks.
+ *  @param[in] size The number of events that fit in the buffer.
+ *  @return The number of events written to the previous buffer, or zero if
+ *  no buffer was set or an [error](@ref error_handling) occurred.
+ *
+ *  @remarks Window systems may report events outside of event processing, for
+ *  example during @ref glfwSetWindowSize.  Those are also written to the
+ *  buffer, so do not let GLFW write to a buffer while you are reading it.
+ *  Alternating between two buffers avoids this.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref events_buffer
+ *  @sa GLFWevent
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup window
+ */
+GLFWAPI int glfwSetEventBuffer(GLFWevent* events, int size);
+
+/*! @brief Sets the callback for a file descriptor watched by event processing.
+ *
+ *  This function adds the specified file descriptor to the set waited on by
+ *  @ref glfwWaitEvents, @ref glfwWaitEventsTimeout and @ref
+ *  glfwWaitEventsUntil, and sets the callback called when it becomes ready.
+ *  This lets a single thread sleep on window system events and, for example,
+ *  network sockets or event descriptors at the same time.  If the file
+ *  descriptor is already watched, its events and callback are replaced.
+ *
+ *  The callback is called from event processing, including @ref
+ *  glfwPollEvents, whenever the file descriptor is ready for any of the
+ *  specified events.  Readiness is level-triggered, so the callback will be
+ *  called again on the next event processing if it does not consume what made
+ *  the descriptor ready.
+ *
+ *  Close a file descriptor only after removing its callback.
+ *
+ *  File descriptors can currently only be watched on X11 and Wayland.
+ *
+ *  @param[in] fd The file descriptor to watch.
+ *  @param[in] events Zero or more of `GLFW_FD_READABLE` and
+ *  `GLFW_FD_WRITABLE`.  Errors are always reported.
+ *  @param[in] cbfun The new callback, or `NULL` to stop watching the file
+ *  descriptor.
+ *  @return The previously set callback, or `NULL` if no callback was set or an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref events_fd
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup window
+ */
+GLFWAPI GLFWfdfun glfwSetFileDescriptorCallback(int fd, int events, GLFWfdfun cbfun);
+
 /*! @brief Returns the value of an input option for the specified window.
  *
  *  This function returns the value of an input option for the specified window.
- *  The mode must be one of `GLFW_CURSOR`, `GLFW_STICKY_KEYS` or
- *  `GLFW_STICKY_MOUSE_BUTTONS`.
+ *  The mode must be one of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
+ *  `GLFW_STICKY_MOUSE_BUTTONS` or `GLFW_COALESCE_CURSOR_MOTION`.
  *
  *  @param[in] window The window to query.
- *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS` or
- *  `GLFW_STICKY_MOUSE_BUTTONS`.
+ *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
+ *  `GLFW_STICKY_MOUSE_BUTTONS` or `GLFW_COALESCE_CURSOR_MOTION`.
  *
  *  @par Thread Safety
  *  This function may only be called from the main thread.
@@ -2403,8 +2896,8 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* window, int mode);
 /*! @brief Sets an input option for the specified window.
  *
  *  This function sets an input mode option for the specified window.  The mode
- *  must be one of `GLFW_CURSOR`, `GLFW_STICKY_KEYS` or
- *  `GLFW_STICKY_MOUSE_BUTTONS`.
+ *  must be one of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
+ *  `GLFW_STICKY_MOUSE_BUTTONS` or `GLFW_COALESCE_CURSOR_MOTION`.
  *
  *  If the mode is `GLFW_CURSOR`, the value must be one of the following cursor
  *  modes:
@@ -2430,9 +2923,19 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* window, int mode);
  *  are only interested in whether mouse buttons have been pressed but not when
  *  or in which order.
  *
+ *  If the mode is `GLFW_COALESCE_CURSOR_MOTION`, the value must be either
+ *  `GL_TRUE` to enable cursor motion coalescing, or `GL_FALSE` to disable it.
+ *  If coalescing is enabled, consecutive cursor motion received during a single
+ *  call to @ref glfwPollEvents or @ref glfwWaitEvents is merged and the
+ *  [cursor position callback](@ref glfwSetCursorPosCallback) is called once
+ *  with the final position.  Pending motion is always delivered before any
+ *  mouse button, scroll, cursor enter/leave or path drop event for the same
+ *  window, so their relative order is kept.  When the cursor is disabled, the
+ *  reported virtual position includes the sum of all merged movement.
+ *
  *  @param[in] window The window whose input mode to set.
- *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS` or
- *  `GLFW_STICKY_MOUSE_BUTTONS`.
+ *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
+ *  `GLFW_STICKY_MOUSE_BUTTONS` or `GLFW_COALESCE_CURSOR_MOTION`.
  *  @param[in] value The new value of the specified input mode.
  *
  *  @par Thread Safety
@@ -2513,6 +3016,79 @@ GLFWAPI int glfwGetKey(GLFWwindow* window, int key);
  */
 GLFWAPI int glfwGetMouseButton(GLFWwindow* window, int button);
 
+/*! @brief Retrieves the state of all keys of the specified window.
+ *
+ *  This function retrieves the last reported state of every
+ *  [named key](@ref keys) of the specified window as bitsets, along with which
+ *  keys were pressed and released during the last event processing.  This is
+ *  faster than calling @ref glfwGetKey for many keys.
+ *
+ *  Each bitset is an array of `GLFW_KEYBOARD_STATE_WORDS` words, where the
+ *  state of a key is bit `key % 32` of word `key / 32`.
+ *
+ *  The `down` bitset follows the same rules as @ref glfwGetKey, including
+ *  the `GLFW_STICKY_KEYS` input mode.  The `pressed` and `released` bitsets are
+ *  reset at the start of every call to @ref glfwPollEvents or any of the wait
+ *  functions, so that a key pressed and released during a single event
+ *  processing pass is still seen, and every call in between returns the
+ *  same edges.
+ *
+ *  Any or all of the bitset arguments may be `NULL`.  If an error occurs, the
+ *  bitsets are left unmodified.
+ *
+ *  @param[in] window The desired window.
+ *  @param[out] down Where to store the keys currently pressed, or `NULL`.
+ *  @param[out] pressed Where to store the keys pressed during the last event
+ *  processing, or `NULL`.
+ *  @param[out] released Where to store the keys released during the last
+ *  event processing, or `NULL`.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref input_key
+ *  @sa glfwGetKey
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwGetKeyboardState(GLFWwindow* window, uint32_t* down, uint32_t* pressed, uint32_t* released);
+
+/*! @brief Retrieves the state of all mouse buttons of the specified window.
+ *
+ *  This function retrieves the last reported state of every
+ *  [mouse button](@ref buttons) of the specified window as a bitset, along
+ *  with which buttons were pressed and released during the last event
+ *  processing.  The state of a button is bit `button` of the word.
+ *
+ *  The `down` bitset follows the same rules as @ref glfwGetMouseButton,
+ *  including the `GLFW_STICKY_MOUSE_BUTTONS` input mode.  The `pressed` and
+ *  `released` bitsets are reset at the start of every call to @ref
+ *  glfwPollEvents or any of the wait functions.
+ *
+ *  Any or all of the bitset arguments may be `NULL`.  If an error occurs, the
+ *  bitsets are left unmodified.
+ *
+ *  @param[in] window The desired window.
+ *  @param[out] down Where to store the buttons currently pressed, or `NULL`.
+ *  @param[out] pressed Where to store the buttons pressed during the last event
+ *  processing, or `NULL`.
+ *  @param[out] released Where to store the buttons released during the last
+ *  event processing, or `NULL`.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref input_mouse_button
+ *  @sa glfwGetMouseButton
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwGetMouseButtonState(GLFWwindow* window, uint32_t* down, uint32_t* pressed, uint32_t* released);
+
 /*! @brief Retrieves the position of the cursor relative to the client area of
  *  the window.
  *
@@ -3046,6 +3622,89 @@ GLFWAPI const unsigned char* glfwGetJoystickButtons(int joy, int* count);
  */
 GLFWAPI const char* glfwGetJoystickName(int joy);
 
+/*! @brief Returns the time of the most recent input sample of the specified
+ *  joystick.
+ *
+ *  This function returns the time, on the [GLFW timer](@ref time), at which
+ *  the current axis and button state of the specified joystick was sampled.
+ *
+ *  On Linux, this is the kernel timestamp of the most recent input event
+ *  received for the joystick, which lets you measure input latency.  On other
+ *  platforms joystick state is sampled when queried, so this is the time of
+ *  the call.
+ *
+ *  @param[in] joy The [joystick](@ref joysticks) to query.
+ *  @return The time, in seconds, of the most recent input sample, or zero if
+ *  the joystick is not present or an [error](@ref error_handling) occurred.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref joystick_time
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup input
+ */
+GLFWAPI double glfwGetJoystickTimestamp(int joy);
+
+/*! @brief Retrieves the buffered axis and button changes of the specified
+ *  joystick.
+ *
+ *  This function moves up to the specified number of buffered axis and button
+ *  changes of the specified joystick, oldest first, into the provided array.
+ *  Unlike @ref glfwGetJoystickAxes and @ref glfwGetJoystickButtons, which only
+ *  return the latest state, this lets you process every sample reported by
+ *  the device since the last call.
+ *
+ *  Changes are buffered as joystick state is updated.  If more changes
+ *  arrive than can be buffered, the newest are discarded until the buffer is
+ *  drained.  The latest state is always available from the regular joystick
+ *  functions.
+ *
+ *  Buffered changes are currently only provided on Linux.  On other platforms
+ *  this function always returns zero.
+ *
+ *  @param[in] joy The [joystick](@ref joysticks) to query.
+ *  @param[out] events The array to store the events in.
+ *  @param[in] count The size, in elements, of the array.
+ *  @return The number of events stored, or zero if none were buffered or an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref joystick_events
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwGetJoystickEvents(int joy, GLFWjoystickevent* events, int count);
+
+/*! @brief Sets whether joystick input wakes up event waiting.
+ *
+ *  This function sets whether joystick input and connections end a wait in
+ *  @ref glfwWaitEvents, @ref glfwWaitEventsTimeout or @ref
+ *  glfwWaitEventsUntil.  It is disabled by default.
+ *
+ *  Joystick wakeup is currently only available on Linux with X11 or Wayland.
+ *  Elsewhere this function does nothing.
+ *
+ *  @param[in] enabled `GL_TRUE` to wake up on joystick input, or `GL_FALSE`
+ *  to not.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref events_fd
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwSetJoystickWakeup(int enabled);
+
 /*! @brief Sets the clipboard to the specified string.
  *
  *  This function sets the system clipboard to the specified, UTF-8 encoded
@@ -3069,6 +3728,52 @@ GLFWAPI const char* glfwGetJoystickName(int joy);
  */
 GLFWAPI void glfwSetClipboardString(GLFWwindow* window, const char* string);
 
+/*! @brief Sets the clipboard to the specified data.
+ *
+ *  This function sets the system clipboard to the specified data, offered as
+ *  each of the specified MIME types, for example `image/png`.  The data is
+ *  not copied, which makes this suitable for images and other large contents.
+ *
+ *  GLFW takes ownership of the data when this function is called, even if it
+ *  fails.  The free function is called with the data once GLFW no longer
+ *  needs it, which is after the clipboard has been replaced or taken by
+ *  another application and any transfers to other applications have
+ *  completed, or when the library is terminated.  It may be called before
+ *  this function returns.
+ *
+ *  @param[in] window The window that will own the clipboard contents.
+ *  @param[in] types The MIME types to offer the data as.
+ *  @param[in] count The number of MIME types in the array.
+ *  @param[in] data The data to place on the clipboard.
+ *  @param[in] size The size, in bytes, of the data.
+ *  @param[in] cbfun The function that frees the data, or `NULL` if it does
+ *  not need to be freed.
+ *
+ *  @remarks __X11:__ The MIME types are offered directly as selection
+ *  targets and the data is sent from the buffer without copying.
+ *
+ *  @remarks __Windows:__ The MIME types are registered as clipboard formats
+ *  and the data is copied to the clipboard once per format.
+ *
+ *  @remarks __OS X:__ The MIME types are used as pasteboard types and the data
+ *  is copied to the pasteboard.
+ *
+ *  @par Pointer Lifetime
+ *  The MIME type strings are copied before this function returns.  The data
+ *  must remain valid until the free function is called.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref clipboard
+ *  @sa glfwSetClipboardString
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwSetClipboardData(GLFWwindow* window, const char** types, int count, void* data, size_t size, GLFWclipboardfreefun cbfun);
+
 /*! @brief Returns the contents of the clipboard as a string.
  *
  *  This function returns the contents of the system clipboard, if it contains
@@ -3096,6 +3801,62 @@ GLFWAPI void glfwSetClipboardString(GLFWwindow* window, const char* string);
  */
 GLFWAPI const char* glfwGetClipboardString(GLFWwindow* window);
 
+/*! @brief Requests the contents of the clipboard as a string.
+ *
+ *  This function requests the contents of the system clipboard, if it contains
+ *  or is convertible to a UTF-8 encoded string, without waiting for it.  The
+ *  specified callback is called with the string, or with `NULL` if the request
+ *  fails or [times out](@ref glfwSetClipboardTimeout), during later event
+ *  processing.
+ *
+ *  Each window can have one request pending.  Requesting again before the
+ *  previous request has completed replaces its callback.
+ *
+ *  @param[in] window The window that will request the clipboard contents.
+ *  @param[in] cbfun The function to call with the clipboard contents.
+ *
+ *  @remarks __X11:__ The clipboard owner is first asked for the formats it
+ *  supports, and then for the best of them, without blocking on either reply.
+ *
+ *  @remarks __Windows, OS X, Wayland, Mir:__ The clipboard is read immediately
+ *  and the callback is called before this function returns.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref clipboard
+ *  @sa glfwGetClipboardString
+ *  @sa glfwSetClipboardTimeout
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwRequestClipboardString(GLFWwindow* window, GLFWclipboardfun cbfun);
+
+/*! @brief Sets the clipboard request timeout.
+ *
+ *  This function sets how long to wait for the owner of the clipboard to
+ *  provide its contents, both for @ref glfwGetClipboardString and @ref
+ *  glfwRequestClipboardString, before giving up.  The default is one second.
+ *
+ *  @param[in] timeout The timeout, in seconds, or zero to wait indefinitely.
+ *
+ *  @remarks This currently only has an effect on X11, where the clipboard is
+ *  provided by another client that may be slow or unresponsive.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref clipboard
+ *  @sa glfwRequestClipboardString
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwSetClipboardTimeout(double timeout);
+
 /*! @brief Returns the value of the GLFW timer.
  *
  *  This function returns the value of the GLFW timer.  Unless the timer has
@@ -3143,6 +3904,42 @@ GLFWAPI double glfwGetTime(void);
  */
 GLFWAPI void glfwSetTime(double time);
 
+/*! @brief Returns the time of the event being processed.
+ *
+ *  This function returns the time, on the [GLFW timer](@ref time), at which
+ *  the window system received the event currently being reported to
+ *  a callback.  This is usually earlier than the time at which the callback is
+ *  called, and is more accurate for measuring input latency or interpolating
+ *  cursor motion.
+ *
+ *  If the window system does not report the time of an event, or if this
+ *  function is called outside of a callback, it returns the current time.
+ *
+ *  @return The time of the event, in seconds, or zero if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @remarks __X11:__ Event times are converted from the X server clock, which
+ *  is assumed to be the monotonic system clock.  Events from servers using
+ *  another clock, such as remote servers, are reported with the current time.
+ *
+ *  @remarks __Wayland:__ Event times are assumed to use the monotonic system
+ *  clock, which is what compositors are expected to use.
+ *
+ *  @remarks __Windows, OS X:__ The time at which the event was processed is
+ *  returned.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref time
+ *  @sa @ref events_time
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup input
+ */
+GLFWAPI double glfwGetEventTime(void);
+
 /*! @brief Makes the context of the specified window current for the calling
  *  thread.
  *
@@ -3256,6 +4053,115 @@ GLFWAPI void glfwSwapBuffers(GLFWwindow* window);
  */
 GLFWAPI void glfwSwapInterval(int interval);
 
+/*! @brief Retrieves the timing of the most recent buffer swap of a window.
+ *
+ *  This function retrieves when the most recently completed buffer swap of the
+ *  specified window was presented, along with the refresh period of the display
+ *  and the number of vertical retraces missed so far.
+ *
+ *  Frame timing is only available for on-screen windows whose context creation
+ *  API provides it, which currently means GLX with `GLX_OML_sync_control` or
+ *  `GLX_INTEL_swap_event` and EGL with `EGL_CHROMIUM_sync_control`.  If it is
+ *  unavailable, this function returns `GL_FALSE` and leaves the structure
+ *  untouched, but does not emit an error.
+ *
+ *  Swaps are counted from the first call to this function for a given window
+ *  on some platforms, so the first result may have a swap buffer counter of
+ *  zero.  Missed retraces are counted relative to the current
+ *  [swap interval](@ref glfwSwapInterval).
+ *
+ *  @param[in] window The window to query.
+ *  @param[out] timing Where to store the timing of the most recent swap.
+ *  @return `GL_TRUE` if frame timing is available for the window, or
+ *  `GL_FALSE` otherwise.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref buffer_swap_timing
+ *  @sa glfwSwapBuffers
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwGetFrameTiming(GLFWwindow* window, GLFWframetiming* timing);
+
+/*! @brief Waits until the latest time a frame can be started.
+ *
+ *  This function predicts the next vertical retrace of the display that is at
+ *  least `renderBudget` seconds away and suspends the calling thread until
+ *  that many seconds before it.  Sampling input and rendering right after this
+ *  function returns keeps the latency between input and presentation close to
+ *  the render budget, instead of the full frame that blocking in @ref
+ *  glfwSwapBuffers adds.
+ *
+ *  Retraces are predicted from the [frame timing](@ref glfwGetFrameTiming) of
+ *  the window where available, and otherwise from the refresh rate of the
+ *  monitor of the window, or of the primary monitor for windowed mode windows.
+ *  Without frame timing, the phase of the retraces is not known and deadlines
+ *  are instead spaced from the first call.
+ *
+ *  This function is meant to be used with a swap interval of zero, or with
+ *  a swap interval of one where a frame occasionally arriving late should not
+ *  tear.
+ *
+ *  @param[in] window The window to pace.
+ *  @param[in] renderBudget The time, in seconds, needed to render and present
+ *  a frame.  This must be zero or positive.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref buffer_swap_pacing
+ *  @sa glfwGetFrameStatistics
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwWaitForFrame(GLFWwindow* window, double renderBudget);
+
+/*! @brief Retrieves the frame pacing statistics of a window.
+ *
+ *  This function retrieves statistics about the frames paced with @ref
+ *  glfwWaitForFrame for the specified window since it was created or since
+ *  @ref glfwResetFrameStatistics was last called for it.
+ *
+ *  @param[in] window The window to query.
+ *  @param[out] stats Where to store the statistics.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref buffer_swap_pacing
+ *  @sa glfwResetFrameStatistics
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwGetFrameStatistics(GLFWwindow* window, GLFWframestats* stats);
+
+/*! @brief Resets the frame pacing statistics of a window.
+ *
+ *  This function discards the frame pacing statistics collected so far for
+ *  the specified window.  The predicted retraces are not affected.
+ *
+ *  @param[in] window The window whose statistics to reset.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref buffer_swap_pacing
+ *  @sa glfwGetFrameStatistics
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwResetFrameStatistics(GLFWwindow* window);
+
 /*! @brief Returns whether the specified extension is available.
  *
  *  This function returns whether the specified
@@ -3266,10 +4172,8 @@ GLFWAPI void glfwSwapInterval(int interval);
  *  A context must be current on the calling thread.  Calling this function
  *  without a current context will cause a @ref GLFW_NO_CURRENT_CONTEXT error.
  *
- *  As this functions retrieves and searches one or more extension strings each
- *  call, it is recommended that you cache its results if it is going to be used
- *  frequently.  The extension strings will not change during the lifetime of
- *  a context, so there is no danger in doing this.
+ *  The extension strings are parsed once per context, so this function is
+ *  cheap to call repeatedly.
  *
  *  @param[in] extension The ASCII encoded name of the extension.
  *  @return `GL_TRUE` if the extension is available, or `GL_FALSE` otherwise.
@@ -3323,6 +4227,149 @@ GLFWAPI int glfwExtensionSupported(const char* extension);
  */
 GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname);
 
+/*! @brief Returns the addresses of the specified functions for the current
+ *  context.
+ *
+ *  This function retrieves the addresses of all the specified
+ *  [core or extension functions](@ref context_glext) in one call, as if by
+ *  calling @ref glfwGetProcAddress for each of them.  It is intended for
+ *  loaders that retrieve hundreds or thousands of functions per context.
+ *
+ *  A context must be current on the calling thread.  Calling this function
+ *  without a current context will cause a @ref GLFW_NO_CURRENT_CONTEXT error.
+ *
+ *  @param[in] procnames The ASCII encoded names of the functions.
+ *  @param[out] procs Where to store the addresses of the functions.  Functions
+ *  that are unavailable are set to `NULL`.
+ *  @param[in] count The number of elements in the arrays.
+ *  @return The number of functions that were found, or zero if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @remarks The same caveats apply to the retrieved addresses as to those
+ *  returned by @ref glfwGetProcAddress.
+ *
+ *  @par Pointer Lifetime
+ *  The retrieved function pointers are valid until the context is destroyed or
+ *  the library is terminated.
+ *
+ *  @par Thread Safety
+ *  This function may be called from any thread.
+ *
+ *  @sa @ref context_glext
+ *  @sa glfwGetProcAddress
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwGetProcAddresses(const char** procnames, GLFWglproc* procs, int count);
+
+/*! @brief Creates a pool of contexts sharing objects with a window.
+ *
+ *  This function creates the specified number of contexts that share objects
+ *  with the context of the specified window, for use by worker threads.  The
+ *  contexts are created up front using the current
+ *  [context and framebuffer hints](@ref window_hints) and a single framebuffer
+ *  config selection.  Where supported, they are created as
+ *  [offscreen](@ref window_hints_wnd) windows.
+ *
+ *  Contexts are taken from the pool with @ref glfwAcquirePooledContext and
+ *  returned to it with @ref glfwReleasePooledContext.  Neither of these
+ *  functions communicates with the window system.
+ *
+ *  @param[in] share The window whose context to share resources with, or
+ *  `NULL` to have the pooled contexts only share with each other.
+ *  @param[in] count The number of contexts to create.  This must be greater
+ *  than zero.
+ *  @return The handle of the created pool, or `NULL` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @remarks The context to share resources with may not be current on any
+ *  other thread while the pool is being created.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref context_pool
+ *  @sa glfwDestroyContextPool
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup context
+ */
+GLFWAPI GLFWcontextpool* glfwCreateSharedContextPool(GLFWwindow* share, int count);
+
+/*! @brief Destroys the specified context pool.
+ *
+ *  This function destroys the specified context pool and all of its contexts.
+ *  None of its contexts may be current on any thread.  Any remaining pools are
+ *  destroyed by @ref glfwTerminate.
+ *
+ *  @param[in] pool The context pool to destroy.
+ *
+ *  @par Reentrancy
+ *  This function may not be called from a callback.
+ *
+ *  @par Thread Safety
+ *  This function may only be called from the main thread.
+ *
+ *  @sa @ref context_pool
+ *  @sa glfwCreateSharedContextPool
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwDestroyContextPool(GLFWcontextpool* pool);
+
+/*! @brief Takes an unused context from the specified pool.
+ *
+ *  This function takes an unused context from the specified pool and returns
+ *  the window that owns it.  Make it current with @ref glfwMakeContextCurrent.
+ *  If all contexts of the pool are in use, this function returns `NULL`
+ *  without generating an error.
+ *
+ *  @param[in] pool The context pool to take a context from.
+ *  @return The window owning the acquired context, or `NULL` if no context was
+ *  available or an [error](@ref error_handling) occurred.
+ *
+ *  @remarks The window owning a pooled context may not be destroyed with @ref
+ *  glfwDestroyWindow.
+ *
+ *  @par Thread Safety
+ *  This function may be called from any thread.
+ *
+ *  @sa @ref context_pool
+ *  @sa glfwReleasePooledContext
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup context
+ */
+GLFWAPI GLFWwindow* glfwAcquirePooledContext(GLFWcontextpool* pool);
+
+/*! @brief Returns a context to the specified pool.
+ *
+ *  This function returns a context previously taken from the specified pool
+ *  with @ref glfwAcquirePooledContext.  If the context is current on the
+ *  calling thread, it is first detached.  It may not be current on any other
+ *  thread.
+ *
+ *  @param[in] pool The context pool the context was taken from.
+ *  @param[in] window The window owning the context to return.
+ *
+ *  @par Thread Safety
+ *  This function may be called from any thread.
+ *
+ *  @sa @ref context_pool
+ *  @sa glfwAcquirePooledContext
+ *
+ *  @since Added in GLFW 3.2.
+ *
+ *  @ingroup context
+ */
+GLFWAPI void glfwReleasePooledContext(GLFWcontextpool* pool, GLFWwindow* window);
+
 
 /*************************************************************************
  * Global definition cleanup
@@ -531,7 +531,7 @@ static int translateKey(unsigned int key)
 
     if (modifierFlags == window->ns.modifierFlags)
     {
-        if (window->keys[key] == GLFW_PRESS)
+        if (key >= 0 && _GLFW_GET_BIT(window->keys.down, key))
             action = GLFW_RELEASE;
         else
             action = GLFW_PRESS;
@@ -929,6 +929,13 @@ int _glfwPlatformCreateWindow(_GLFWwindow* window,
                               const _GLFWctxconfig* ctxconfig,
                               const _GLFWfbconfig* fbconfig)
 {
+    if (wndconfig->offscreen)
+    {
+        _glfwInputError(GLFW_API_UNAVAILABLE,
+                        "Cocoa: Offscreen windows are not supported");
+        return GL_FALSE;
+    }
+
     if (!initializeAppKit())
         return GL_FALSE;
 
@@ -1120,6 +1127,19 @@ void _glfwPlatformWaitEvents(void)
     _glfwPlatformPollEvents();
 }
 
+void _glfwPlatformWaitEventsTimeout(double timeout)
+{
+    NSDate* date = [NSDate dateWithTimeIntervalSinceNow:timeout];
+    NSEvent* event = [NSApp nextEventMatchingMask:NSAnyEventMask
+                                        untilDate:date
+                                           inMode:NSDefaultRunLoopMode
+                                          dequeue:YES];
+    if (event)
+        [NSApp sendEvent:event];
+
+    _glfwPlatformPollEvents();
+}
+
 void _glfwPlatformPostEmptyEvent(void)
 {
     NSAutoreleasePool* pool = [[NSAutoreleasePool alloc] init];
@@ -1136,6 +1156,21 @@ void _glfwPlatformPostEmptyEvent(void)
     [pool drain];
 }
 
+int _glfwPlatformWatchFileDescriptor(int fd, int events)
+{
+    _glfwInputError(GLFW_API_UNAVAILABLE,
+                    "Cocoa: Watching file descriptors is not supported");
+    return GL_FALSE;
+}
+
+void _glfwPlatformUnwatchFileDescriptor(int fd)
+{
+}
+
+void _glfwPlatformSetJoystickWakeup(int enabled)
+{
+}
+
 void _glfwPlatformGetCursorPos(_GLFWwindow* window, double* xpos, double* ypos)
 {
     const NSRect contentRect = [window->ns.view frame];
@@ -1266,6 +1301,30 @@ void _glfwPlatformSetClipboardString(_GLFWwindow* window, const char* string)
                   forType:NSStringPboardType];
 }
 
+void _glfwPlatformSetClipboardData(_GLFWwindow* window,
+                                   const char** types, int count,
+                                   void* data, size_t size,
+                                   GLFWclipboardfreefun cbfun)
+{
+    int i;
+    NSMutableArray* typeArray = [NSMutableArray arrayWithCapacity:count];
+
+    for (i = 0;  i < count;  i++)
+        [typeArray addObject:[NSString stringWithUTF8String:types[i]]];
+
+    NSPasteboard* pasteboard = [NSPasteboard generalPasteboard];
+    [pasteboard declareTypes:typeArray owner:nil];
+
+    // The pasteboard needs its own copy of the data
+    NSData* object = [NSData dataWithBytes:data length:size];
+
+    for (NSString* type in typeArray)
+        [pasteboard setData:object forType:type];
+
+    if (cbfun)
+        cbfun(data);
+}
+
 const char* _glfwPlatformGetClipboardString(_GLFWwindow* window)
 {
     NSPasteboard* pasteboard = [NSPasteboard generalPasteboard];
@@ -1291,6 +1350,11 @@ const char* _glfwPlatformGetClipboardString(_GLFWwindow* window)
     return _glfw.ns.clipboardString;
 }
 
+void _glfwPlatformRequestClipboardString(_GLFWwindow* window)
+{
+    _glfwInputClipboardString(window, _glfwPlatformGetClipboardString(window));
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
@@ -28,11 +28,238 @@
 #include "internal.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <limits.h>
 #include <stdio.h>
+#include <math.h>
 
 
+// Returns the hash of the specified extension or function name
+//
+static unsigned int hashName(const char* name)
+{
+    // This is 32-bit FNV-1a
+    unsigned int hash = 2166136261u;
+
+    while (*name)
+    {
+        hash ^= (unsigned char) *name++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+#if defined(_GLFW_CACHE_PROC_ADDRESSES)
+
+// Inserts an entry into the function pointer cache, which must have room
+//
+static void insertProcEntry(const _GLFWprocentry* entry)
+{
+    unsigned int slot = entry->hash & (_glfw.procCache.size - 1);
+
+    while (_glfw.procCache.entries[slot].name)
+        slot = (slot + 1) & (_glfw.procCache.size - 1);
+
+    _glfw.procCache.entries[slot] = *entry;
+}
+
+// Returns the address of the specified function, retrieving it from the context
+// API only the first time
+// The cache mutex must be held by the caller
+//
+static GLFWglproc getCachedProcAddress(const char* procname)
+{
+    _GLFWprocentry entry;
+    const unsigned int hash = hashName(procname);
+    unsigned int slot = hash & (_glfw.procCache.size - 1);
+
+    while (_glfw.procCache.entries[slot].name)
+    {
+        const _GLFWprocentry* e = _glfw.procCache.entries + slot;
+        if (e->hash == hash && strcmp(e->name, procname) == 0)
+            return e->proc;
+
+        slot = (slot + 1) & (_glfw.procCache.size - 1);
+    }
+
+    // Keep the table at most half full to keep probe sequences short
+    if ((_glfw.procCache.count + 1) * 2 > _glfw.procCache.size)
+    {
+        unsigned int i;
+        _GLFWprocentry* entries = _glfw.procCache.entries;
+        const unsigned int size = _glfw.procCache.size;
+
+        _glfw.procCache.size *= 2;
+        _glfw.procCache.entries = calloc(_glfw.procCache.size,
+                                         sizeof(_GLFWprocentry));
+
+        for (i = 0;  i < size;  i++)
+        {
+            if (entries[i].name)
+                insertProcEntry(entries + i);
+        }
+
+        free(entries);
+    }
+
+    entry.name = strdup(procname);
+    entry.hash = hash;
+    entry.proc = _glfwPlatformGetProcAddress(procname);
+
+    insertProcEntry(&entry);
+    _glfw.procCache.count++;
+
+    return entry.proc;
+}
+
+#endif // _GLFW_CACHE_PROC_ADDRESSES
+
+// Builds the extension set of the current context
+//
+static GLboolean buildExtensionSet(_GLFWwindow* window)
+{
+#if defined(_GLFW_USE_OPENGL)
+    if (window->context.major >= 3)
+    {
+        int i;
+        GLint count = 0;
+        size_t length = 0;
+        const char** names;
+        char* extensions;
+        char* end;
+
+        // Join the modern OpenGL extension string list into a single string
+
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+        names = calloc(count + 1, sizeof(char*));
+
+        for (i = 0;  i < count;  i++)
+        {
+            names[i] = (const char*) window->GetStringi(GL_EXTENSIONS, i);
+            if (!names[i])
+            {
+                _glfwInputError(GLFW_PLATFORM_ERROR,
+                                "Failed to retrieve extension string %i", i);
+                free(names);
+                return GL_FALSE;
+            }
+
+            length += strlen(names[i]) + 1;
+        }
+
+        extensions = calloc(length + 1, 1);
+        end = extensions;
+
+        for (i = 0;  i < count;  i++)
+        {
+            const size_t nameLength = strlen(names[i]);
+            memcpy(end, names[i], nameLength);
+            end += nameLength;
+            *end++ = ' ';
+        }
+
+        _glfwInitExtensionSet(&window->extensions, extensions);
+
+        free(extensions);
+        free(names);
+        return GL_TRUE;
+    }
+#endif // _GLFW_USE_OPENGL
+
+    {
+        const GLubyte* extensions = glGetString(GL_EXTENSIONS);
+        if (!extensions)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Failed to retrieve extension string");
+            return GL_FALSE;
+        }
+
+        _glfwInitExtensionSet(&window->extensions, (const char*) extensions);
+        return GL_TRUE;
+    }
+}
+
+// Returns the refresh period of the monitor of the window, or of the primary
+// monitor for windowed mode windows
+//
+static double getMonitorPeriod(_GLFWwindow* window)
+{
+    _GLFWmonitor* monitor = window->monitor;
+
+    if (!monitor && _glfw.monitorCount)
+        monitor = _glfw.monitors[0];
+
+    if (monitor)
+    {
+        GLFWvidmode mode;
+        _glfwPlatformGetVideoMode(monitor, &mode);
+
+        if (mode.refreshRate > 0)
+            return 1.0 / mode.refreshRate;
+    }
+
+    // Assume the most common refresh rate if the monitor does not report one
+    return 1.0 / 60.0;
+}
+
+// Adds a measured frame to the pacing statistics of the window
+//
+static void updateFrameStatistics(_GLFWwindow* window,
+                                  double frameTime, double wakeLatency)
+{
+    double delta;
+
+    window->pacing.frameCount++;
+
+    if (window->pacing.frameCount == 1)
+    {
+        window->pacing.minFrameTime = frameTime;
+        window->pacing.maxFrameTime = frameTime;
+    }
+    else
+    {
+        if (frameTime < window->pacing.minFrameTime)
+            window->pacing.minFrameTime = frameTime;
+        if (frameTime > window->pacing.maxFrameTime)
+            window->pacing.maxFrameTime = frameTime;
+    }
+
+    // This is Welford's method, which does not lose precision over long runs
+    delta = frameTime - window->pacing.meanFrameTime;
+    window->pacing.meanFrameTime += delta / window->pacing.frameCount;
+    window->pacing.squaredDeviations +=
+        delta * (frameTime - window->pacing.meanFrameTime);
+
+    window->pacing.totalWakeLatency += wakeLatency;
+    if (wakeLatency > window->pacing.maxWakeLatency)
+        window->pacing.maxWakeLatency = wakeLatency;
+}
+
+// Returns whether the two framebuffer configs have the same attributes
+//
+static GLboolean isSameFBConfig(const _GLFWfbconfig* a, const _GLFWfbconfig* b)
+{
+    return a->redBits == b->redBits &&
+           a->greenBits == b->greenBits &&
+           a->blueBits == b->blueBits &&
+           a->alphaBits == b->alphaBits &&
+           a->depthBits == b->depthBits &&
+           a->stencilBits == b->stencilBits &&
+           a->accumRedBits == b->accumRedBits &&
+           a->accumGreenBits == b->accumGreenBits &&
+           a->accumBlueBits == b->accumBlueBits &&
+           a->accumAlphaBits == b->accumAlphaBits &&
+           a->auxBuffers == b->auxBuffers &&
+           a->stereo == b->stereo &&
+           a->samples == b->samples &&
+           a->sRGB == b->sRGB &&
+           a->doublebuffer == b->doublebuffer;
+}
+
 // Parses the client API version string and extracts the version number
 //
 static GLboolean parseVersionString(int* api, int* major, int* minor, int* rev)
@@ -348,6 +575,36 @@ const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
     return closest;
 }
 
+const _GLFWfbconfig* _glfwChooseCachedFBConfig(const _GLFWfbconfig* desired,
+                                               const _GLFWfbconfig* alternatives,
+                                               unsigned int count)
+{
+    int i;
+    const _GLFWfbconfig* closest;
+
+    for (i = 0;  i < _glfw.fbconfigCacheCount;  i++)
+    {
+        if (_glfw.fbconfigCache[i].alternatives == alternatives &&
+            isSameFBConfig(&_glfw.fbconfigCache[i].desired, desired))
+        {
+            return _glfw.fbconfigCache[i].closest;
+        }
+    }
+
+    closest = _glfwChooseFBConfig(desired, alternatives, count);
+
+    i = _glfw.fbconfigCacheNext;
+    _glfw.fbconfigCache[i].desired = *desired;
+    _glfw.fbconfigCache[i].alternatives = alternatives;
+    _glfw.fbconfigCache[i].closest = closest;
+
+    _glfw.fbconfigCacheNext = (i + 1) % _GLFW_FBCONFIG_CACHE_SIZE;
+    if (_glfw.fbconfigCacheCount < _GLFW_FBCONFIG_CACHE_SIZE)
+        _glfw.fbconfigCacheCount++;
+
+    return closest;
+}
+
 GLboolean _glfwRefreshContextAttribs(const _GLFWctxconfig* ctxconfig)
 {
     _GLFWwindow* window = _glfwPlatformGetCurrentContext();
@@ -375,7 +632,14 @@ GLboolean _glfwRefreshContextAttribs(const _GLFWctxconfig* ctxconfig)
             return GL_FALSE;
         }
     }
+#endif // _GLFW_USE_OPENGL
 
+    // The extensions are parsed once here, as applications often probe for
+    // dozens of them for every context
+    if (!buildExtensionSet(window))
+        return GL_FALSE;
+
+#if defined(_GLFW_USE_OPENGL)
     if (window->context.api == GLFW_OPENGL_API)
     {
         // Read back context flags (OpenGL 3.0 and above)
@@ -490,6 +754,110 @@ GLboolean _glfwIsValidContext(const _GLFWctxconfig* ctxconfig)
     return GL_TRUE;
 }
 
+void _glfwInitExtensionSet(_GLFWextset* set, const char* extensions)
+{
+    size_t i, length;
+    unsigned int count = 0;
+
+    if (!extensions)
+        extensions = "";
+
+    length = strlen(extensions);
+    set->names = malloc(length + 1);
+    memcpy(set->names, extensions, length + 1);
+
+    // Split the copy into null terminated names and count them
+    for (i = 0;  i < length;  i++)
+    {
+        if (set->names[i] == ' ')
+            set->names[i] = '\0';
+        else if (i == 0 || set->names[i - 1] == '\0')
+            count++;
+    }
+
+    // Keep the table at most half full to keep probe sequences short
+    set->size = 16;
+    while (set->size < count * 2)
+        set->size *= 2;
+
+    set->slots = calloc(set->size, sizeof(char*));
+
+    for (i = 0;  i < length;  i++)
+    {
+        const char* name = set->names + i;
+        unsigned int slot;
+
+        if (*name == '\0' || (i > 0 && set->names[i - 1] != '\0'))
+            continue;
+
+        slot = hashName(name) & (set->size - 1);
+        while (set->slots[slot])
+        {
+            if (strcmp(set->slots[slot], name) == 0)
+                break;
+
+            slot = (slot + 1) & (set->size - 1);
+        }
+
+        set->slots[slot] = name;
+    }
+}
+
+void _glfwFreeExtensionSet(_GLFWextset* set)
+{
+    free(set->names);
+    free(set->slots);
+    memset(set, 0, sizeof(_GLFWextset));
+}
+
+int _glfwExtensionSetContains(const _GLFWextset* set, const char* extension)
+{
+    unsigned int slot;
+
+    if (!set->size)
+        return GL_FALSE;
+
+    slot = hashName(extension) & (set->size - 1);
+    while (set->slots[slot])
+    {
+        if (strcmp(set->slots[slot], extension) == 0)
+            return GL_TRUE;
+
+        slot = (slot + 1) & (set->size - 1);
+    }
+
+    return GL_FALSE;
+}
+
+GLboolean _glfwInitProcCache(void)
+{
+#if defined(_GLFW_CACHE_PROC_ADDRESSES)
+    if (!_glfwCreateMutex(&_glfw.procCache.mutex))
+        return GL_FALSE;
+
+    // This is enough for most loaders without growing the table
+    _glfw.procCache.size = 4096;
+    _glfw.procCache.entries = calloc(_glfw.procCache.size,
+                                     sizeof(_GLFWprocentry));
+#endif // _GLFW_CACHE_PROC_ADDRESSES
+
+    return GL_TRUE;
+}
+
+void _glfwTerminateProcCache(void)
+{
+#if defined(_GLFW_CACHE_PROC_ADDRESSES)
+    unsigned int i;
+
+    for (i = 0;  i < _glfw.procCache.size;  i++)
+        free(_glfw.procCache.entries[i].name);
+
+    free(_glfw.procCache.entries);
+    _glfwDestroyMutex(&_glfw.procCache.mutex);
+    memset(&_glfw.procCache, 0, sizeof(_glfw.procCache));
+#endif // _GLFW_CACHE_PROC_ADDRESSES
+}
+
 int _glfwStringInExtensionString(const char* string, const GLubyte* extensions)
 {
     const GLubyte* start;
@@ -546,17 +914,148 @@ GLFWAPI void glfwSwapBuffers(GLFWwindow* handle)
 
 GLFWAPI void glfwSwapInterval(int interval)
 {
+    _GLFWwindow* window;
+
     _GLFW_REQUIRE_INIT();
 
-    if (!_glfwPlatformGetCurrentContext())
+    window = _glfwPlatformGetCurrentContext();
+    if (!window)
     {
         _glfwInputError(GLFW_NO_CURRENT_CONTEXT, NULL);
         return;
     }
 
+    window->swapInterval = interval;
     _glfwPlatformSwapInterval(interval);
 }
 
+GLFWAPI int glfwGetFrameTiming(GLFWwindow* handle, GLFWframetiming* timing)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GL_FALSE);
+
+    if (window->offscreen)
+        return GL_FALSE;
+
+    if (!_glfwPlatformGetFrameTiming(window))
+        return GL_FALSE;
+
+    *timing = window->frame;
+    return GL_TRUE;
+}
+
+GLFWAPI void glfwWaitForFrame(GLFWwindow* handle, double renderBudget)
+{
+    double now, period, anchor, vblank, deadline, wakeTime;
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+
+    _GLFW_REQUIRE_INIT();
+
+    if (renderBudget < 0.0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid render budget");
+        return;
+    }
+
+    // Presentation feedback provides both the real refresh period and the
+    // phase of the retraces
+    if (!window->offscreen)
+        _glfwPlatformGetFrameTiming(window);
+
+    period = window->frame.refreshPeriod;
+    if (period <= 0.0)
+    {
+        // Querying the video mode may require a round-trip to the server
+        if (window->pacing.monitorPeriod <= 0.0)
+            window->pacing.monitorPeriod = getMonitorPeriod(window);
+
+        period = window->pacing.monitorPeriod;
+    }
+
+    now = _glfwPlatformGetTime();
+
+    if (window->frame.presentTime > 0.0)
+        anchor = window->frame.presentTime;
+    else
+    {
+        if (!window->pacing.started)
+            window->pacing.anchor = now;
+
+        anchor = window->pacing.anchor;
+    }
+
+    // Pick the first retrace that still leaves the whole budget
+    vblank = anchor + (floor((now + renderBudget - anchor) / period) + 1.0) *
+                      period;
+    deadline = vblank - renderBudget;
+
+    if (window->pacing.started &&
+        vblank - window->pacing.vblank > period * 1.5)
+    {
+        window->pacing.missedDeadlines +=
+            (int) ((vblank - window->pacing.vblank) / period + 0.5) - 1;
+    }
+
+    _glfwPlatformSleepUntil(deadline);
+    wakeTime = _glfwPlatformGetTime();
+
+    if (window->pacing.started)
+    {
+        updateFrameStatistics(window,
+                              wakeTime - window->pacing.wakeTime,
+                              wakeTime > deadline ? wakeTime - deadline : 0.0);
+    }
+
+    window->pacing.started = GL_TRUE;
+    window->pacing.vblank = vblank;
+    window->pacing.wakeTime = wakeTime;
+}
+
+GLFWAPI void glfwGetFrameStatistics(GLFWwindow* handle, GLFWframestats* stats)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+
+    _GLFW_REQUIRE_INIT();
+
+    memset(stats, 0, sizeof(GLFWframestats));
+
+    stats->frameCount = window->pacing.frameCount;
+    stats->missedDeadlines = window->pacing.missedDeadlines;
+
+    if (window->pacing.frameCount)
+    {
+        stats->meanFrameTime = window->pacing.meanFrameTime;
+        stats->minFrameTime = window->pacing.minFrameTime;
+        stats->maxFrameTime = window->pacing.maxFrameTime;
+        stats->meanWakeLatency = window->pacing.totalWakeLatency /
+                                 window->pacing.frameCount;
+        stats->maxWakeLatency = window->pacing.maxWakeLatency;
+    }
+
+    if (window->pacing.frameCount > 1)
+    {
+        stats->frameTimeDeviation = sqrt(window->pacing.squaredDeviations /
+                                         (window->pacing.frameCount - 1));
+    }
+}
+
+GLFWAPI void glfwResetFrameStatistics(GLFWwindow* handle)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+
+    _GLFW_REQUIRE_INIT();
+
+    window->pacing.frameCount = 0;
+    window->pacing.missedDeadlines = 0;
+    window->pacing.meanFrameTime = 0.0;
+    window->pacing.squaredDeviations = 0.0;
+    window->pacing.minFrameTime = 0.0;
+    window->pacing.maxFrameTime = 0.0;
+    window->pacing.totalWakeLatency = 0.0;
+    window->pacing.maxWakeLatency = 0.0;
+}
+
 GLFWAPI int glfwExtensionSupported(const char* extension)
 {
     _GLFWwindow* window;
@@ -576,61 +1075,244 @@ GLFWAPI int glfwExtensionSupported(const char* extension)
         return GL_FALSE;
     }
 
-#if defined(_GLFW_USE_OPENGL)
-    if (window->context.major >= 3)
+    // Contexts whose attributes were not read back build their set on first
+    // use instead
+    if (!window->extensions.size)
     {
-        int i;
-        GLint count;
+        if (!buildExtensionSet(window))
+            return GL_FALSE;
+    }
 
-        // Check if extension is in the modern OpenGL extensions string list
+    if (_glfwExtensionSetContains(&window->extensions, extension))
+        return GL_TRUE;
 
-        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    // Check if extension is in the platform-specific string
+    return _glfwPlatformExtensionSupported(extension);
+}
 
-        for (i = 0;  i < count;  i++)
-        {
-            const char* en = (const char*) window->GetStringi(GL_EXTENSIONS, i);
-            if (!en)
-            {
-                _glfwInputError(GLFW_PLATFORM_ERROR,
-                                "Failed to retrieve extension string %i", i);
-                return GL_FALSE;
-            }
+GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-            if (strcmp(en, extension) == 0)
-                return GL_TRUE;
-        }
+    if (!_glfwPlatformGetCurrentContext())
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT, NULL);
+        return NULL;
     }
-    else
-#endif // _GLFW_USE_OPENGL
+
+#if defined(_GLFW_CACHE_PROC_ADDRESSES)
     {
-        // Check if extension is in the old style OpenGL extensions string
+        GLFWglproc proc;
 
-        const GLubyte* extensions = glGetString(GL_EXTENSIONS);
-        if (!extensions)
+        _glfwLockMutex(&_glfw.procCache.mutex);
+        proc = getCachedProcAddress(procname);
+        _glfwUnlockMutex(&_glfw.procCache.mutex);
+
+        return proc;
+    }
+#else
+    return _glfwPlatformGetProcAddress(procname);
+#endif // _GLFW_CACHE_PROC_ADDRESSES
+}
+
+GLFWAPI int glfwGetProcAddresses(const char** procnames,
+                                 GLFWglproc* procs,
+                                 int count)
+{
+    int i, found = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (!_glfwPlatformGetCurrentContext())
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT, NULL);
+        return 0;
+    }
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid function count");
+        return 0;
+    }
+
+#if defined(_GLFW_CACHE_PROC_ADDRESSES)
+    _glfwLockMutex(&_glfw.procCache.mutex);
+#endif
+
+    for (i = 0;  i < count;  i++)
+    {
+#if defined(_GLFW_CACHE_PROC_ADDRESSES)
+        procs[i] = getCachedProcAddress(procnames[i]);
+#else
+        procs[i] = _glfwPlatformGetProcAddress(procnames[i]);
+#endif
+        if (procs[i])
+            found++;
+    }
+
+#if defined(_GLFW_CACHE_PROC_ADDRESSES)
+    _glfwUnlockMutex(&_glfw.procCache.mutex);
+#endif
+
+    return found;
+}
+
+GLFWAPI GLFWcontextpool* glfwCreateSharedContextPool(GLFWwindow* share, int count)
+{
+    int i;
+    _GLFWfbconfig fbconfig;
+    _GLFWctxconfig ctxconfig;
+    _GLFWwndconfig wndconfig;
+    _GLFWcontextpool* pool;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    if (count <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid context pool size");
+        return NULL;
+    }
+
+    fbconfig  = _glfw.hints.framebuffer;
+    ctxconfig = _glfw.hints.context;
+
+    memset(&wndconfig, 0, sizeof(wndconfig));
+    wndconfig.width  = 1;
+    wndconfig.height = 1;
+    wndconfig.title  = "";
+#if defined(_GLFW_WIN32) || defined(_GLFW_COCOA)
+    // Offscreen windows are not available here, so use hidden ones
+    wndconfig.offscreen = GL_FALSE;
+#else
+    wndconfig.offscreen = GL_TRUE;
+#endif
+
+    ctxconfig.share = (_GLFWwindow*) share;
+
+    if (!_glfwIsValidContextConfig(&ctxconfig))
+        return NULL;
+
+    pool = calloc(1, sizeof(_GLFWcontextpool));
+    pool->next = _glfw.contextPoolListHead;
+    _glfw.contextPoolListHead = pool;
+
+    if (!_glfwCreateMutex(&pool->mutex))
+    {
+        glfwDestroyContextPool((GLFWcontextpool*) pool);
+        return NULL;
+    }
+
+    pool->windows = calloc(count, sizeof(_GLFWwindow*));
+    pool->available = calloc(count, sizeof(_GLFWwindow*));
+
+    for (i = 0;  i < count;  i++)
+    {
+        _GLFWwindow* window;
+
+        // Without a window to share with, the pooled contexts share with the
+        // first one so that they all share objects with each other
+        if (!share && i > 0)
+            ctxconfig.share = pool->windows[0];
+
+        // Only the first context is read back and validated, as the rest are
+        // created from identical configs
+        window = _glfwCreateWindow(&wndconfig, &ctxconfig, &fbconfig,
+                                   i > 0 ? pool->windows[0] : NULL);
+        if (!window)
         {
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "Failed to retrieve extension string");
-            return GL_FALSE;
+            glfwDestroyContextPool((GLFWcontextpool*) pool);
+            return NULL;
         }
 
-        if (_glfwStringInExtensionString(extension, extensions))
-            return GL_TRUE;
+        window->pool = pool;
+        pool->windows[pool->count++] = window;
+        pool->available[pool->availableCount++] = window;
     }
 
-    // Check if extension is in the platform-specific string
-    return _glfwPlatformExtensionSupported(extension);
+    return (GLFWcontextpool*) pool;
 }
 
-GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
+GLFWAPI void glfwDestroyContextPool(GLFWcontextpool* handle)
+{
+    int i;
+    _GLFWcontextpool* pool = (_GLFWcontextpool*) handle;
+
+    _GLFW_REQUIRE_INIT();
+
+    // Allow destroying of NULL (to match the behavior of free)
+    if (pool == NULL)
+        return;
+
+    // Destroy the contexts in reverse order of creation, as the later ones may
+    // share with the first
+    for (i = pool->count - 1;  i >= 0;  i--)
+    {
+        pool->windows[i]->pool = NULL;
+        glfwDestroyWindow((GLFWwindow*) pool->windows[i]);
+    }
+
+    _glfwDestroyMutex(&pool->mutex);
+
+    // Unlink pool from global linked list
+    {
+        _GLFWcontextpool** prev = &_glfw.contextPoolListHead;
+
+        while (*prev != pool)
+            prev = &((*prev)->next);
+
+        *prev = pool->next;
+    }
+
+    free(pool->windows);
+    free(pool->available);
+    free(pool);
+}
+
+GLFWAPI GLFWwindow* glfwAcquirePooledContext(GLFWcontextpool* handle)
 {
+    _GLFWwindow* window = NULL;
+    _GLFWcontextpool* pool = (_GLFWcontextpool*) handle;
+
     _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-    if (!_glfwPlatformGetCurrentContext())
+    _glfwLockMutex(&pool->mutex);
+
+    if (pool->availableCount)
     {
-        _glfwInputError(GLFW_NO_CURRENT_CONTEXT, NULL);
-        return NULL;
+        window = pool->available[--pool->availableCount];
+        window->acquired = GL_TRUE;
     }
 
-    return _glfwPlatformGetProcAddress(procname);
+    _glfwUnlockMutex(&pool->mutex);
+
+    return (GLFWwindow*) window;
 }
 
+GLFWAPI void glfwReleasePooledContext(GLFWcontextpool* handle,
+                                      GLFWwindow* windowHandle)
+{
+    _GLFWcontextpool* pool = (_GLFWcontextpool*) handle;
+    _GLFWwindow* window = (_GLFWwindow*) windowHandle;
+
+    _GLFW_REQUIRE_INIT();
+
+    if (window->pool != pool)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Context does not belong to the specified pool");
+        return;
+    }
+
+    if (window == _glfwPlatformGetCurrentContext())
+        _glfwPlatformMakeContextCurrent(NULL);
+
+    _glfwLockMutex(&pool->mutex);
+
+    if (window->acquired)
+    {
+        window->acquired = GL_FALSE;
+        pool->available[pool->availableCount++] = window;
+    }
+
+    _glfwUnlockMutex(&pool->mutex);
+}
@@ -82,15 +82,15 @@ static int getConfigAttrib(EGLConfig config, int attrib)
     return value;
 }
 
-// Return a list of available and usable framebuffer configs
+// Builds the table of available and usable framebuffer configs for the
+// specified renderable type, for either windows or offscreen surfaces
 //
-static GLboolean chooseFBConfigs(const _GLFWctxconfig* ctxconfig,
-                                 const _GLFWfbconfig* desired,
-                                 EGLConfig* result)
+static GLboolean buildFBConfigTable(GLboolean offscreen,
+                                    int index,
+                                    EGLint renderable)
 {
     EGLConfig* nativeConfigs;
     _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
     int i, nativeCount, usableCount;
 
     eglGetConfigs(_glfw.egl.display, NULL, 0, &nativeCount);
@@ -111,39 +111,36 @@ static GLboolean chooseFBConfigs(const _GLFWctxconfig* ctxconfig,
         const EGLConfig n = nativeConfigs[i];
         _GLFWfbconfig* u = usableConfigs + usableCount;
 
-#if defined(_GLFW_X11)
-        // Only consider EGLConfigs with associated visuals
-        if (!getConfigAttrib(n, EGL_NATIVE_VISUAL_ID))
-            continue;
-#endif // _GLFW_X11
-
         // Only consider RGB(A) EGLConfigs
         if (!(getConfigAttrib(n, EGL_COLOR_BUFFER_TYPE) & EGL_RGB_BUFFER))
             continue;
 
-        // Only consider window EGLConfigs
-        if (!(getConfigAttrib(n, EGL_SURFACE_TYPE) & EGL_WINDOW_BIT))
-            continue;
-
-        if (ctxconfig->api == GLFW_OPENGL_ES_API)
+        if (offscreen)
         {
-            if (ctxconfig->major == 1)
+            // Only consider pbuffer EGLConfigs unless no surface is needed
+            if (!_glfw.egl.KHR_surfaceless_context &&
+                !(getConfigAttrib(n, EGL_SURFACE_TYPE) & EGL_PBUFFER_BIT))
             {
-                if (!(getConfigAttrib(n, EGL_RENDERABLE_TYPE) & EGL_OPENGL_ES_BIT))
-                    continue;
-            }
-            else
-            {
-                if (!(getConfigAttrib(n, EGL_RENDERABLE_TYPE) & EGL_OPENGL_ES2_BIT))
-                    continue;
+                continue;
             }
         }
-        else if (ctxconfig->api == GLFW_OPENGL_API)
+        else
         {
-            if (!(getConfigAttrib(n, EGL_RENDERABLE_TYPE) & EGL_OPENGL_BIT))
+#if defined(_GLFW_X11)
+            // Only consider EGLConfigs with associated visuals
+            if (!getConfigAttrib(n, EGL_NATIVE_VISUAL_ID))
+                continue;
+#endif // _GLFW_X11
+
+            // Only consider window EGLConfigs
+            if (!(getConfigAttrib(n, EGL_SURFACE_TYPE) & EGL_WINDOW_BIT))
                 continue;
         }
 
+        // Only consider EGLConfigs supporting the requested client API
+        if (!(getConfigAttrib(n, EGL_RENDERABLE_TYPE) & renderable))
+            continue;
+
         u->redBits = getConfigAttrib(n, EGL_RED_SIZE);
         u->greenBits = getConfigAttrib(n, EGL_GREEN_SIZE);
         u->blueBits = getConfigAttrib(n, EGL_BLUE_SIZE);
@@ -159,14 +156,59 @@ static GLboolean chooseFBConfigs(const _GLFWctxconfig* ctxconfig,
         usableCount++;
     }
 
-    closest = _glfwChooseFBConfig(desired, usableConfigs, usableCount);
-    if (closest)
-        *result = closest->egl;
-
     free(nativeConfigs);
-    free(usableConfigs);
 
-    return closest ? GL_TRUE : GL_FALSE;
+    _glfw.egl.fbconfigs[offscreen][index] = usableConfigs;
+    _glfw.egl.fbconfigCount[offscreen][index] = usableCount;
+    return GL_TRUE;
+}
+
+// Return the usable framebuffer config closest to the desired one
+//
+static GLboolean chooseFBConfigs(const _GLFWctxconfig* ctxconfig,
+                                 const _GLFWfbconfig* desired,
+                                 GLboolean offscreen,
+                                 EGLConfig* result)
+{
+    int index;
+    EGLint renderable;
+    const _GLFWfbconfig* closest;
+
+    if (ctxconfig->api == GLFW_OPENGL_ES_API)
+    {
+        if (ctxconfig->major == 1)
+        {
+            index = 0;
+            renderable = EGL_OPENGL_ES_BIT;
+        }
+        else
+        {
+            index = 1;
+            renderable = EGL_OPENGL_ES2_BIT;
+        }
+    }
+    else
+    {
+        index = 2;
+        renderable = EGL_OPENGL_BIT;
+    }
+
+    // Each table is only built once per display, as querying every attribute
+    // of every EGLConfig is slow on drivers with hundreds of them
+    if (!_glfw.egl.fbconfigs[offscreen][index])
+    {
+        if (!buildFBConfigTable(offscreen, index, renderable))
+            return GL_FALSE;
+    }
+
+    closest = _glfwChooseCachedFBConfig(desired,
+                                        _glfw.egl.fbconfigs[offscreen][index],
+                                        _glfw.egl.fbconfigCount[offscreen][index]);
+    if (!closest)
+        return GL_FALSE;
+
+    *result = closest->egl;
+    return GL_TRUE;
 }
 
 
@@ -198,9 +240,24 @@ int _glfwInitContextAPI(void)
         return GL_FALSE;
     }
 
+    _glfwInitExtensionSet(&_glfw.egl.extensions,
+                          eglQueryString(_glfw.egl.display, EGL_EXTENSIONS));
+
     if (_glfwPlatformExtensionSupported("EGL_KHR_create_context"))
         _glfw.egl.KHR_create_context = GL_TRUE;
 
+    if (_glfwPlatformExtensionSupported("EGL_KHR_surfaceless_context"))
+        _glfw.egl.KHR_surfaceless_context = GL_TRUE;
+
+    if (_glfwPlatformExtensionSupported("EGL_CHROMIUM_sync_control"))
+    {
+        _glfw.egl.GetSyncValuesCHROMIUM = (PFNEGLGETSYNCVALUESCHROMIUMPROC)
+            eglGetProcAddress("eglGetSyncValuesCHROMIUM");
+
+        if (_glfw.egl.GetSyncValuesCHROMIUM)
+            _glfw.egl.CHROMIUM_sync_control = GL_TRUE;
+    }
+
     return GL_TRUE;
 }
 
@@ -208,6 +265,20 @@ int _glfwInitContextAPI(void)
 //
 void _glfwTerminateContextAPI(void)
 {
+    int i, j;
+
+    for (i = 0;  i < 2;  i++)
+    {
+        for (j = 0;  j < 3;  j++)
+        {
+            free(_glfw.egl.fbconfigs[i][j]);
+            _glfw.egl.fbconfigs[i][j] = NULL;
+            _glfw.egl.fbconfigCount[i][j] = 0;
+        }
+    }
+
+    _glfwFreeExtensionSet(&_glfw.egl.extensions);
+
     eglTerminate(_glfw.egl.display);
 
     _glfwDestroyContextTLS();
@@ -233,7 +304,7 @@ int _glfwCreateContext(_GLFWwindow* window,
     if (ctxconfig->share)
         share = ctxconfig->share->egl.context;
 
-    if (!chooseFBConfigs(ctxconfig, fbconfig, &config))
+    if (!chooseFBConfigs(ctxconfig, fbconfig, window->offscreen, &config))
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "EGL: Failed to find a suitable EGLConfig");
@@ -242,6 +313,7 @@ int _glfwCreateContext(_GLFWwindow* window,
 
 #if defined(_GLFW_X11)
     // Retrieve the visual corresponding to the chosen EGL config
+    if (!window->offscreen)
     {
         EGLint count = 0;
         int mask;
@@ -384,6 +456,28 @@ int _glfwCreateContext(_GLFWwindow* window,
 
     window->egl.config = config;
 
+    // Offscreen contexts are made current without a surface where possible
+    if (window->offscreen && !_glfw.egl.KHR_surfaceless_context)
+    {
+        const EGLint surfaceAttribs[] =
+        {
+            EGL_WIDTH, window->videoMode.width,
+            EGL_HEIGHT, window->videoMode.height,
+            EGL_NONE
+        };
+
+        window->egl.surface = eglCreatePbufferSurface(_glfw.egl.display,
+                                                      config,
+                                                      surfaceAttribs);
+        if (window->egl.surface == EGL_NO_SURFACE)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "EGL: Failed to create pbuffer surface: %s",
+                            getErrorString(eglGetError()));
+            return GL_FALSE;
+        }
+    }
+
     return GL_TRUE;
 }
 
@@ -436,7 +530,7 @@ void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
 {
     if (window)
     {
-        if (window->egl.surface == EGL_NO_SURFACE)
+        if (window->egl.surface == EGL_NO_SURFACE && !window->offscreen)
         {
             window->egl.surface = eglCreateWindowSurface(_glfw.egl.display,
                                                          window->egl.config,
@@ -466,26 +560,55 @@ void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
 
 void _glfwPlatformSwapBuffers(_GLFWwindow* window)
 {
+    // Surfaceless contexts have no default framebuffer to present
+    if (window->egl.surface == EGL_NO_SURFACE)
+        return;
+
     eglSwapBuffers(_glfw.egl.display, window->egl.surface);
 }
 
 void _glfwPlatformSwapInterval(int interval)
 {
+    _GLFWwindow* window = _glfwPlatformGetCurrentContext();
+
+    // Offscreen surfaces are never presented, so there is nothing to
+    // synchronize
+    if (window->offscreen)
+        return;
+
     eglSwapInterval(_glfw.egl.display, interval);
 }
 
-int _glfwPlatformExtensionSupported(const char* extension)
+int _glfwPlatformGetFrameTiming(_GLFWwindow* window)
 {
-    const char* extensions;
+    khronos_uint64_t ust, msc, sbc;
 
-    extensions = eglQueryString(_glfw.egl.display, EGL_EXTENSIONS);
-    if (extensions != NULL)
+    if (!_glfw.egl.CHROMIUM_sync_control)
+        return GL_FALSE;
+
+    // The window surface is created when the context is first made current
+    if (window->egl.surface == EGL_NO_SURFACE)
+        return GL_TRUE;
+
+    // This reports the current retrace rather than that of the swap, so the
+    // swap is attributed to the retrace at which it was seen to complete
+    if (_glfw.egl.GetSyncValuesCHROMIUM(_glfw.egl.display, window->egl.surface,
+                                        &ust, &msc, &sbc))
     {
-        if (_glfwStringInExtensionString(extension, (unsigned char*) extensions))
-            return GL_TRUE;
+#if defined(_GLFW_WIN32)
+        _glfwInputFrameTiming(window, ust, msc, sbc, 0.0);
+#else
+        _glfwInputFrameTiming(window, ust, msc, sbc,
+                              _glfwConvertMonotonicTimestamp(ust));
+#endif
     }
 
-    return GL_FALSE;
+    return GL_TRUE;
+}
+
+int _glfwPlatformExtensionSupported(const char* extension)
+{
+    return _glfwExtensionSetContains(&_glfw.egl.extensions, extension);
 }
 
 GLFWglproc _glfwPlatformGetProcAddress(const char* procname)
@@ -39,6 +39,13 @@
 #define _GLFW_PLATFORM_CONTEXT_STATE            _GLFWcontextEGL egl
 #define _GLFW_PLATFORM_LIBRARY_CONTEXT_STATE    _GLFWlibraryEGL egl
 
+// EGL client API entry points do not depend on the current context
+#define _GLFW_CACHE_PROC_ADDRESSES
+
+#ifndef EGL_CHROMIUM_sync_control
+typedef EGLBoolean (EGLAPIENTRYP PFNEGLGETSYNCVALUESCHROMIUMPROC)(EGLDisplay, EGLSurface, khronos_uint64_t*, khronos_uint64_t*, khronos_uint64_t*);
+#endif
+
 
 // EGL-specific per-context data
 //
@@ -63,6 +70,18 @@ typedef struct _GLFWlibraryEGL
     EGLint          major, minor;
 
     GLboolean       KHR_create_context;
+    GLboolean       KHR_surfaceless_context;
+    GLboolean       CHROMIUM_sync_control;
+
+    PFNEGLGETSYNCVALUESCHROMIUMPROC GetSyncValuesCHROMIUM;
+
+    // EGL extensions of the display
+    _GLFWextset     extensions;
+
+    // Usable EGLConfigs for windows and offscreen surfaces, for OpenGL ES 1.x,
+    // OpenGL ES 2.0+ and OpenGL, each built on first use
+    _GLFWfbconfig*  fbconfigs[2][3];
+    int             fbconfigCount[2][3];
 
 } _GLFWlibraryEGL;
 
@@ -46,13 +46,13 @@ static int getFBConfigAttrib(GLXFBConfig fbconfig, int attrib)
     return value;
 }
 
-// Return a list of available and usable framebuffer configs
+// Builds the table of available and usable framebuffer configs for windows
+// or for pbuffers
 //
-static GLboolean chooseFBConfig(const _GLFWfbconfig* desired, GLXFBConfig* result)
+static GLboolean buildFBConfigTable(GLboolean offscreen)
 {
     GLXFBConfig* nativeConfigs;
     _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
     int i, nativeCount, usableCount;
     const char* vendor;
     GLboolean trustWindowBit = GL_TRUE;
@@ -79,19 +79,28 @@ static GLboolean chooseFBConfig(const _GLFWfbconfig* desired, GLXFBConfig* resul
         const GLXFBConfig n = nativeConfigs[i];
         _GLFWfbconfig* u = usableConfigs + usableCount;
 
-        // Only consider GLXFBConfigs with associated visuals
-        if (!getFBConfigAttrib(n, GLX_VISUAL_ID))
-            continue;
-
         // Only consider RGBA GLXFBConfigs
         if (!(getFBConfigAttrib(n, GLX_RENDER_TYPE) & GLX_RGBA_BIT))
             continue;
 
-        // Only consider window GLXFBConfigs
-        if (!(getFBConfigAttrib(n, GLX_DRAWABLE_TYPE) & GLX_WINDOW_BIT))
+        if (offscreen)
+        {
+            // Only consider pbuffer GLXFBConfigs
+            if (!(getFBConfigAttrib(n, GLX_DRAWABLE_TYPE) & GLX_PBUFFER_BIT))
+                continue;
+        }
+        else
         {
-            if (trustWindowBit)
+            // Only consider GLXFBConfigs with associated visuals
+            if (!getFBConfigAttrib(n, GLX_VISUAL_ID))
                 continue;
+
+            // Only consider window GLXFBConfigs
+            if (!(getFBConfigAttrib(n, GLX_DRAWABLE_TYPE) & GLX_WINDOW_BIT))
+            {
+                if (trustWindowBit)
+                    continue;
+            }
         }
 
         u->redBits = getFBConfigAttrib(n, GLX_RED_SIZE);
@@ -124,14 +133,73 @@ static GLboolean chooseFBConfig(const _GLFWfbconfig* desired, GLXFBConfig* resul
         usableCount++;
     }
 
-    closest = _glfwChooseFBConfig(desired, usableConfigs, usableCount);
-    if (closest)
-        *result = closest->glx;
-
     XFree(nativeConfigs);
-    free(usableConfigs);
 
-    return closest ? GL_TRUE : GL_FALSE;
+    _glfw.glx.fbconfigs[offscreen] = usableConfigs;
+    _glfw.glx.fbconfigCount[offscreen] = usableCount;
+    return GL_TRUE;
+}
+
+// Return the usable framebuffer config closest to the desired one
+//
+static GLboolean chooseFBConfig(const _GLFWfbconfig* desired,
+                                GLboolean offscreen,
+                                GLXFBConfig* result)
+{
+    const _GLFWfbconfig* closest;
+
+    // The table is only built once per display, as querying every attribute
+    // of every GLXFBConfig is slow on drivers with hundreds of them
+    if (!_glfw.glx.fbconfigs[offscreen])
+    {
+        if (!buildFBConfigTable(offscreen))
+            return GL_FALSE;
+    }
+
+    closest = _glfwChooseCachedFBConfig(desired,
+                                        _glfw.glx.fbconfigs[offscreen],
+                                        _glfw.glx.fbconfigCount[offscreen]);
+    if (!closest)
+        return GL_FALSE;
+
+    *result = closest->glx;
+    return GL_TRUE;
+}
+
+// Create the pbuffer used as the drawable of an offscreen window
+//
+static GLboolean createPbuffer(_GLFWwindow* window, GLXFBConfig fbconfig)
+{
+    const int attribs[] =
+    {
+        GLX_PBUFFER_WIDTH, window->videoMode.width,
+        GLX_PBUFFER_HEIGHT, window->videoMode.height,
+        None
+    };
+
+    _glfwGrabXErrorHandler();
+
+    window->glx.pbuffer = glXCreatePbuffer(_glfw.x11.display, fbconfig, attribs);
+
+    _glfwReleaseXErrorHandler();
+
+    if (!window->glx.pbuffer)
+    {
+        _glfwInputXError(GLFW_PLATFORM_ERROR, "GLX: Failed to create pbuffer");
+        return GL_FALSE;
+    }
+
+    return GL_TRUE;
+}
+
+// Returns the GLX drawable of the specified window
+//
+static GLXDrawable getDrawable(_GLFWwindow* window)
+{
+    if (window->offscreen)
+        return window->glx.pbuffer;
+
+    return window->x11.handle;
 }
 
 // Create the OpenGL context using legacy API
@@ -193,6 +261,10 @@ int _glfwInitContextAPI(void)
         return GL_FALSE;
     }
 
+    _glfwInitExtensionSet(&_glfw.glx.extensions,
+                          glXQueryExtensionsString(_glfw.x11.display,
+                                                   _glfw.x11.screen));
+
     if (_glfwPlatformExtensionSupported("GLX_EXT_swap_control"))
     {
         _glfw.glx.SwapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC)
@@ -247,6 +319,26 @@ int _glfwInitContextAPI(void)
     if (_glfwPlatformExtensionSupported("GLX_ARB_context_flush_control"))
         _glfw.glx.ARB_context_flush_control = GL_TRUE;
 
+    if (_glfwPlatformExtensionSupported("GLX_OML_sync_control"))
+    {
+        _glfw.glx.GetSyncValuesOML = (PFNGLXGETSYNCVALUESOMLPROC)
+            _glfwPlatformGetProcAddress("glXGetSyncValuesOML");
+        _glfw.glx.GetMscRateOML = (PFNGLXGETMSCRATEOMLPROC)
+            _glfwPlatformGetProcAddress("glXGetMscRateOML");
+        _glfw.glx.WaitForSbcOML = (PFNGLXWAITFORSBCOMLPROC)
+            _glfwPlatformGetProcAddress("glXWaitForSbcOML");
+
+        if (_glfw.glx.GetSyncValuesOML &&
+            _glfw.glx.GetMscRateOML &&
+            _glfw.glx.WaitForSbcOML)
+        {
+            _glfw.glx.OML_sync_control = GL_TRUE;
+        }
+    }
+
+    if (_glfwPlatformExtensionSupported("GLX_INTEL_swap_event"))
+        _glfw.glx.INTEL_swap_event = GL_TRUE;
+
     return GL_TRUE;
 }
 
@@ -254,6 +346,17 @@ int _glfwInitContextAPI(void)
 //
 void _glfwTerminateContextAPI(void)
 {
+    int i;
+
+    for (i = 0;  i < 2;  i++)
+    {
+        free(_glfw.glx.fbconfigs[i]);
+        _glfw.glx.fbconfigs[i] = NULL;
+        _glfw.glx.fbconfigCount[i] = 0;
+    }
+
+    _glfwFreeExtensionSet(&_glfw.glx.extensions);
+
     if (_glfw.glx.handle)
     {
         dlclose(_glfw.glx.handle);
@@ -283,19 +386,23 @@ int _glfwCreateContext(_GLFWwindow* window,
     if (ctxconfig->share)
         share = ctxconfig->share->glx.context;
 
-    if (!chooseFBConfig(fbconfig, &native))
+    if (!chooseFBConfig(fbconfig, window->offscreen, &native))
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "GLX: Failed to find a suitable GLXFBConfig");
         return GL_FALSE;
     }
 
-    window->glx.visual = glXGetVisualFromFBConfig(_glfw.x11.display, native);
-    if (!window->glx.visual)
+    if (!window->offscreen)
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "GLX: Failed to retrieve visual for GLXFBConfig");
-        return GL_FALSE;
+        window->glx.visual = glXGetVisualFromFBConfig(_glfw.x11.display,
+                                                      native);
+        if (!window->glx.visual)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "GLX: Failed to retrieve visual for GLXFBConfig");
+            return GL_FALSE;
+        }
     }
 
     if (ctxconfig->api == GLFW_OPENGL_ES_API)
@@ -439,6 +546,12 @@ int _glfwCreateContext(_GLFWwindow* window,
         return GL_FALSE;
     }
 
+    if (window->offscreen)
+    {
+        if (!createPbuffer(window, native))
+            return GL_FALSE;
+    }
+
     return GL_TRUE;
 }
 
@@ -454,6 +567,12 @@ void _glfwDestroyContext(_GLFWwindow* window)
         window->glx.visual = NULL;
     }
 
+    if (window->glx.pbuffer)
+    {
+        glXDestroyPbuffer(_glfw.x11.display, window->glx.pbuffer);
+        window->glx.pbuffer = None;
+    }
+
     if (window->glx.context)
     {
         glXDestroyContext(_glfw.x11.display, window->glx.context);
@@ -461,6 +580,16 @@ void _glfwDestroyContext(_GLFWwindow* window)
     }
 }
 
+// Process a swap completion event from GLX_INTEL_swap_event
+//
+void _glfwInputSwapCompleteGLX(_GLFWwindow* window,
+                               const GLXBufferSwapComplete* event)
+{
+    _glfwInputFrameTiming(window,
+                          event->ust, event->msc, event->sbc,
+                          _glfwConvertMonotonicTimestamp(event->ust));
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -471,7 +600,7 @@ void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
     if (window)
     {
         glXMakeCurrent(_glfw.x11.display,
-                       window->x11.handle,
+                       getDrawable(window),
                        window->glx.context);
     }
     else
@@ -482,13 +611,17 @@ void _glfwPlatformMakeContextCurrent(_GLFWwindow* window)
 
 void _glfwPlatformSwapBuffers(_GLFWwindow* window)
 {
-    glXSwapBuffers(_glfw.x11.display, window->x11.handle);
+    glXSwapBuffers(_glfw.x11.display, getDrawable(window));
 }
 
 void _glfwPlatformSwapInterval(int interval)
 {
     _GLFWwindow* window = _glfwPlatformGetCurrentContext();
 
+    // Pbuffers are never presented, so there is nothing to synchronize
+    if (window->offscreen)
+        return;
+
     if (_glfw.glx.EXT_swap_control)
     {
         _glfw.glx.SwapIntervalEXT(_glfw.x11.display,
@@ -504,19 +637,53 @@ void _glfwPlatformSwapInterval(int interval)
     }
 }
 
-int _glfwPlatformExtensionSupported(const char* extension)
+int _glfwPlatformGetFrameTiming(_GLFWwindow* window)
 {
-    const GLubyte* extensions =
-        (const GLubyte*) glXQueryExtensionsString(_glfw.x11.display,
-                                                  _glfw.x11.screen);
+    int64_t ust, msc, sbc;
+    int32_t numerator, denominator;
+
+    if (!_glfw.glx.OML_sync_control && !_glfw.glx.INTEL_swap_event)
+        return GL_FALSE;
 
-    if (extensions)
+    if (_glfw.glx.INTEL_swap_event && !window->glx.swapEvents)
     {
-        if (_glfwStringInExtensionString(extension, extensions))
-            return GL_TRUE;
+        // Swap completion events are only requested once they are wanted, as
+        // they otherwise add an event per frame for every window
+        glXSelectEvent(_glfw.x11.display,
+                       window->x11.handle,
+                       GLX_BUFFER_SWAP_COMPLETE_INTEL_MASK);
+        window->glx.swapEvents = GL_TRUE;
     }
 
-    return GL_FALSE;
+    if (_glfw.glx.OML_sync_control)
+    {
+        // Waiting for a swap that has already completed does not block and
+        // yields the UST and MSC of that swap rather than of the current
+        // retrace
+        if (_glfw.glx.GetSyncValuesOML(_glfw.x11.display, window->x11.handle,
+                                       &ust, &msc, &sbc) &&
+            sbc > 0 &&
+            _glfw.glx.WaitForSbcOML(_glfw.x11.display, window->x11.handle,
+                                    sbc, &ust, &msc, &sbc))
+        {
+            _glfwInputFrameTiming(window, ust, msc, sbc,
+                                  _glfwConvertMonotonicTimestamp(ust));
+        }
+
+        if (_glfw.glx.GetMscRateOML(_glfw.x11.display, window->x11.handle,
+                                    &numerator, &denominator) &&
+            numerator > 0 && denominator > 0)
+        {
+            window->frame.refreshPeriod = (double) denominator / numerator;
+        }
+    }
+
+    return GL_TRUE;
+}
+
+int _glfwPlatformExtensionSupported(const char* extension)
+{
+    return _glfwExtensionSetContains(&_glfw.glx.extensions, extension);
 }
 
 GLFWglproc _glfwPlatformGetProcAddress(const char* procname)
@@ -41,6 +41,9 @@
 #define _GLFW_PLATFORM_CONTEXT_STATE            _GLFWcontextGLX glx
 #define _GLFW_PLATFORM_LIBRARY_CONTEXT_STATE    _GLFWlibraryGLX glx
 
+// GLX entry points do not depend on the current context
+#define _GLFW_CACHE_PROC_ADDRESSES
+
 #ifndef GLX_MESA_swap_control
 typedef int (*PFNGLXSWAPINTERVALMESAPROC)(int);
 #endif
@@ -54,6 +57,10 @@ typedef struct _GLFWcontextGLX
     GLXContext      context;
     // Visual of selected GLXFBConfig
     XVisualInfo*    visual;
+    // Drawable of offscreen windows
+    GLXPbuffer      pbuffer;
+    // Whether swap completion events have been selected for the window
+    GLboolean       swapEvents;
 
 } _GLFWcontextGLX;
 
@@ -69,6 +76,13 @@ typedef struct _GLFWlibraryGLX
     // dlopen handle for libGL.so.1
     void*           handle;
 
+    // GLX extensions of the screen
+    _GLFWextset     extensions;
+
+    // Usable GLXFBConfigs for windows and pbuffers, each built on first use
+    _GLFWfbconfig*  fbconfigs[2];
+    int             fbconfigCount[2];
+
     // GLX extensions
     PFNGLXGETPROCADDRESSPROC              GetProcAddress;
     PFNGLXGETPROCADDRESSPROC              GetProcAddressARB;
@@ -76,6 +90,9 @@ typedef struct _GLFWlibraryGLX
     PFNGLXSWAPINTERVALEXTPROC             SwapIntervalEXT;
     PFNGLXSWAPINTERVALMESAPROC            SwapIntervalMESA;
     PFNGLXCREATECONTEXTATTRIBSARBPROC     CreateContextAttribsARB;
+    PFNGLXGETSYNCVALUESOMLPROC            GetSyncValuesOML;
+    PFNGLXGETMSCRATEOMLPROC               GetMscRateOML;
+    PFNGLXWAITFORSBCOMLPROC               WaitForSbcOML;
     GLboolean       SGI_swap_control;
     GLboolean       EXT_swap_control;
     GLboolean       MESA_swap_control;
@@ -86,6 +103,8 @@ typedef struct _GLFWlibraryGLX
     GLboolean       ARB_create_context_robustness;
     GLboolean       EXT_create_context_es2_profile;
     GLboolean       ARB_context_flush_control;
+    GLboolean       OML_sync_control;
+    GLboolean       INTEL_swap_event;
 
 } _GLFWlibraryGLX;
 
@@ -96,5 +115,7 @@ int _glfwCreateContext(_GLFWwindow* window,
                        const _GLFWctxconfig* ctxconfig,
                        const _GLFWfbconfig* fbconfig);
 void _glfwDestroyContext(_GLFWwindow* window);
+void _glfwInputSwapCompleteGLX(_GLFWwindow* window,
+                               const GLXBufferSwapComplete* event);
 
 #endif // _glfw3_glx_context_h_
@@ -128,6 +128,15 @@ GLFWAPI int glfwInit(void)
         return GL_FALSE;
     }
 
+    if (!_glfwInitProcCache())
+    {
+        _glfwPlatformTerminate();
+        return GL_FALSE;
+    }
+
+    _glfwInitUserEvents();
+    _glfw.clipboardTimeout = _GLFW_CLIPBOARD_TIMEOUT;
+
     _glfw.monitors = _glfwPlatformGetMonitors(&_glfw.monitorCount);
     _glfwInitialized = GL_TRUE;
 
@@ -146,6 +155,9 @@ GLFWAPI void glfwTerminate(void)
 
     memset(&_glfw.callbacks, 0, sizeof(_glfw.callbacks));
 
+    while (_glfw.contextPoolListHead)
+        glfwDestroyContextPool((GLFWcontextpool*) _glfw.contextPoolListHead);
+
     while (_glfw.windowListHead)
         glfwDestroyWindow((GLFWwindow*) _glfw.windowListHead);
 
@@ -164,6 +176,9 @@ GLFWAPI void glfwTerminate(void)
     _glfw.monitorCount = 0;
 
     _glfwPlatformTerminate();
+    _glfwTerminateProcCache();
+
+    free(_glfw.watches);
 
     memset(&_glfw, 0, sizeof(_glfw));
     _glfwInitialized = GL_FALSE;
@@ -28,13 +28,45 @@
 #include "internal.h"
 
 #include <stdlib.h>
+#include <string.h>
 #if defined(_MSC_VER)
  #include <malloc.h>
 #endif
 
-// Internal key state used for sticky keys
-#define _GLFW_STICK 3
 
+// Delivers a cursor position to the event buffer or the callback
+//
+static void inputCursorPos(_GLFWwindow* window, double x, double y)
+{
+    GLFWevent* event = _glfwBufferEvent(window, GLFW_EVENT_CURSOR_POS);
+    if (event)
+    {
+        event->data.cursorPos.x = x;
+        event->data.cursorPos.y = y;
+        return;
+    }
+
+    if (window->callbacks.cursorPos)
+        window->callbacks.cursorPos((GLFWwindow*) window, x, y);
+}
+
+// Delivers any coalesced cursor motion of the specified window
+//
+static void flushCursorMotion(_GLFWwindow* window)
+{
+    const double time = _glfw.eventTime;
+
+    if (!window->motionPending)
+        return;
+
+    // The motion is reported with the time of the last event it coalesced
+    _glfw.eventTime = window->motionTime;
+
+    window->motionPending = GL_FALSE;
+    inputCursorPos(window, window->motionPosX, window->motionPosY);
+
+    _glfw.eventTime = time;
+}
 
 // Sets the cursor mode for the specified window
 //
@@ -53,6 +85,8 @@ static void setCursorMode(_GLFWwindow* window, int newMode)
     if (oldMode == newMode)
         return;
 
+    flushCursorMotion(window);
+
     window->cursorMode = newMode;
 
     if (_glfw.focusedWindow == window)
@@ -89,17 +123,9 @@ static void setStickyKeys(_GLFWwindow* window, int enabled)
     if (window->stickyKeys == enabled)
         return;
 
+    // Release all sticky keys
     if (!enabled)
-    {
-        int i;
-
-        // Release all sticky keys
-        for (i = 0;  i <= GLFW_KEY_LAST;  i++)
-        {
-            if (window->keys[i] == _GLFW_STICK)
-                window->keys[i] = GLFW_RELEASE;
-        }
-    }
+        memset(window->keys.stuck, 0, sizeof(window->keys.stuck));
 
     window->stickyKeys = enabled;
 }
@@ -111,21 +137,26 @@ static void setStickyMouseButtons(_GLFWwindow* window, int enabled)
     if (window->stickyMouseButtons == enabled)
         return;
 
+    // Release all sticky mouse buttons
     if (!enabled)
-    {
-        int i;
-
-        // Release all sticky mouse buttons
-        for (i = 0;  i <= GLFW_MOUSE_BUTTON_LAST;  i++)
-        {
-            if (window->mouseButtons[i] == _GLFW_STICK)
-                window->mouseButtons[i] = GLFW_RELEASE;
-        }
-    }
+        memset(window->mouseButtons.stuck, 0, sizeof(window->mouseButtons.stuck));
 
     window->stickyMouseButtons = enabled;
 }
 
+// Set cursor motion coalescing mode for the specified window
+//
+static void setCoalesceMotion(_GLFWwindow* window, int enabled)
+{
+    if (window->coalesceMotion == enabled)
+        return;
+
+    if (!enabled)
+        flushCursorMotion(window);
+
+    window->coalesceMotion = enabled;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
@@ -133,23 +164,41 @@ static void setStickyMouseButtons(_GLFWwindow* window, int enabled)
 
 void _glfwInputKey(_GLFWwindow* window, int key, int scancode, int action, int mods)
 {
+    GLFWevent* event;
+
     if (key >= 0 && key <= GLFW_KEY_LAST)
     {
-        GLboolean repeated = GL_FALSE;
+        const GLboolean down = _GLFW_GET_BIT(window->keys.down, key);
 
-        if (action == GLFW_RELEASE && window->keys[key] == GLFW_RELEASE)
-            return;
+        if (action == GLFW_RELEASE)
+        {
+            if (!down)
+                return;
 
-        if (action == GLFW_PRESS && window->keys[key] == GLFW_PRESS)
-            repeated = GL_TRUE;
+            _GLFW_CLEAR_BIT(window->keys.down, key);
+            _GLFW_SET_BIT(window->keys.released, key);
 
-        if (action == GLFW_RELEASE && window->stickyKeys)
-            window->keys[key] = _GLFW_STICK;
+            if (window->stickyKeys)
+                _GLFW_SET_BIT(window->keys.stuck, key);
+        }
+        else if (down)
+            action = GLFW_REPEAT;
         else
-            window->keys[key] = (char) action;
+        {
+            _GLFW_SET_BIT(window->keys.down, key);
+            _GLFW_SET_BIT(window->keys.pressed, key);
+            _GLFW_CLEAR_BIT(window->keys.stuck, key);
+        }
+    }
 
-        if (repeated)
-            action = GLFW_REPEAT;
+    event = _glfwBufferEvent(window, GLFW_EVENT_KEY);
+    if (event)
+    {
+        event->data.key.key = key;
+        event->data.key.scancode = scancode;
+        event->data.key.action = action;
+        event->data.key.mods = mods;
+        return;
     }
 
     if (window->callbacks.key)
@@ -158,9 +207,20 @@ void _glfwInputKey(_GLFWwindow* window, int key, int scancode, int action, int m
 
 void _glfwInputChar(_GLFWwindow* window, unsigned int codepoint, int mods, int plain)
 {
+    GLFWevent* event;
+
     if (codepoint < 32 || (codepoint > 126 && codepoint < 160))
         return;
 
+    event = _glfwBufferEvent(window, GLFW_EVENT_CHAR);
+    if (event)
+    {
+        event->data.character.codepoint = codepoint;
+        event->data.character.mods = mods;
+        event->data.character.plain = plain;
+        return;
+    }
+
     if (window->callbacks.charmods)
         window->callbacks.charmods((GLFWwindow*) window, codepoint, mods);
 
@@ -173,20 +233,55 @@ void _glfwInputChar(_GLFWwindow* window, unsigned int codepoint, int mods, int p
 
 void _glfwInputScroll(_GLFWwindow* window, double xoffset, double yoffset)
 {
+    GLFWevent* event;
+
+    flushCursorMotion(window);
+
+    event = _glfwBufferEvent(window, GLFW_EVENT_SCROLL);
+    if (event)
+    {
+        event->data.scroll.x = xoffset;
+        event->data.scroll.y = yoffset;
+        return;
+    }
+
     if (window->callbacks.scroll)
         window->callbacks.scroll((GLFWwindow*) window, xoffset, yoffset);
 }
 
 void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
 {
+    GLFWevent* event;
+
     if (button < 0 || button > GLFW_MOUSE_BUTTON_LAST)
         return;
 
+    flushCursorMotion(window);
+
     // Register mouse button action
-    if (action == GLFW_RELEASE && window->stickyMouseButtons)
-        window->mouseButtons[button] = _GLFW_STICK;
+    if (action == GLFW_RELEASE)
+    {
+        _GLFW_CLEAR_BIT(window->mouseButtons.down, button);
+        _GLFW_SET_BIT(window->mouseButtons.released, button);
+
+        if (window->stickyMouseButtons)
+            _GLFW_SET_BIT(window->mouseButtons.stuck, button);
+    }
     else
-        window->mouseButtons[button] = (char) action;
+    {
+        _GLFW_SET_BIT(window->mouseButtons.down, button);
+        _GLFW_SET_BIT(window->mouseButtons.pressed, button);
+        _GLFW_CLEAR_BIT(window->mouseButtons.stuck, button);
+    }
+
+    event = _glfwBufferEvent(window, GLFW_EVENT_MOUSE_BUTTON);
+    if (event)
+    {
+        event->data.mouseButton.button = button;
+        event->data.mouseButton.action = action;
+        event->data.mouseButton.mods = mods;
+        return;
+    }
 
     if (window->callbacks.mouseButton)
         window->callbacks.mouseButton((GLFWwindow*) window, button, action, mods);
@@ -206,22 +301,67 @@ void _glfwInputCursorMotion(_GLFWwindow* window, double x, double y)
         y = window->cursorPosY;
     }
 
-    if (window->callbacks.cursorPos)
-        window->callbacks.cursorPos((GLFWwindow*) window, x, y);
+    if (window->coalesceMotion)
+    {
+        window->motionPending = GL_TRUE;
+        window->motionPosX = x;
+        window->motionPosY = y;
+        window->motionTime = _glfw.eventTime;
+        return;
+    }
+
+    inputCursorPos(window, x, y);
 }
 
 void _glfwInputCursorEnter(_GLFWwindow* window, int entered)
 {
+    GLFWevent* event;
+
+    flushCursorMotion(window);
+
+    event = _glfwBufferEvent(window, GLFW_EVENT_CURSOR_ENTER);
+    if (event)
+    {
+        event->data.state = entered;
+        return;
+    }
+
     if (window->callbacks.cursorEnter)
         window->callbacks.cursorEnter((GLFWwindow*) window, entered);
 }
 
 void _glfwInputDrop(_GLFWwindow* window, int count, const char** paths)
 {
+    flushCursorMotion(window);
+
     if (window->callbacks.drop)
         window->callbacks.drop((GLFWwindow*) window, count, paths);
 }
 
+void _glfwInputEventTime(double time)
+{
+    _glfw.eventTime = time;
+}
+
+void _glfwInputClipboardString(_GLFWwindow* window, const char* string)
+{
+    GLFWclipboardfun callback = window->callbacks.clipboard;
+
+    // The callback may request the clipboard again
+    window->callbacks.clipboard = NULL;
+
+    if (callback)
+        callback((GLFWwindow*) window, string);
+}
+
+void _glfwFlushCursorMotion(void)
+{
+    _GLFWwindow* window;
+
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+        flushCursorMotion(window);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW public API                       //////
@@ -241,6 +381,8 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* handle, int mode)
             return window->stickyKeys;
         case GLFW_STICKY_MOUSE_BUTTONS:
             return window->stickyMouseButtons;
+        case GLFW_COALESCE_CURSOR_MOTION:
+            return window->coalesceMotion;
         default:
             _glfwInputError(GLFW_INVALID_ENUM, "Invalid input mode");
             return 0;
@@ -264,6 +406,9 @@ GLFWAPI void glfwSetInputMode(GLFWwindow* handle, int mode, int value)
         case GLFW_STICKY_MOUSE_BUTTONS:
             setStickyMouseButtons(window, value ? GL_TRUE : GL_FALSE);
             break;
+        case GLFW_COALESCE_CURSOR_MOTION:
+            setCoalesceMotion(window, value ? GL_TRUE : GL_FALSE);
+            break;
         default:
             _glfwInputError(GLFW_INVALID_ENUM, "Invalid input mode");
             break;
@@ -282,14 +427,14 @@ GLFWAPI int glfwGetKey(GLFWwindow* handle, int key)
         return GLFW_RELEASE;
     }
 
-    if (window->keys[key] == _GLFW_STICK)
+    if (_GLFW_GET_BIT(window->keys.stuck, key))
     {
         // Sticky mode: release key now
-        window->keys[key] = GLFW_RELEASE;
+        _GLFW_CLEAR_BIT(window->keys.stuck, key);
         return GLFW_PRESS;
     }
 
-    return (int) window->keys[key];
+    return _GLFW_GET_BIT(window->keys.down, key) ? GLFW_PRESS : GLFW_RELEASE;
 }
 
 GLFWAPI int glfwGetMouseButton(GLFWwindow* handle, int button)
@@ -305,14 +450,64 @@ GLFWAPI int glfwGetMouseButton(GLFWwindow* handle, int button)
         return GLFW_RELEASE;
     }
 
-    if (window->mouseButtons[button] == _GLFW_STICK)
+    if (_GLFW_GET_BIT(window->mouseButtons.stuck, button))
     {
         // Sticky mode: release mouse button now
-        window->mouseButtons[button] = GLFW_RELEASE;
+        _GLFW_CLEAR_BIT(window->mouseButtons.stuck, button);
+        return GLFW_PRESS;
+    }
+
+    if (_GLFW_GET_BIT(window->mouseButtons.down, button))
         return GLFW_PRESS;
+
+    return GLFW_RELEASE;
+}
+
+GLFWAPI void glfwGetKeyboardState(GLFWwindow* handle,
+                                  uint32_t* down,
+                                  uint32_t* pressed,
+                                  uint32_t* released)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+
+    _GLFW_REQUIRE_INIT();
+
+    if (down)
+    {
+        int i;
+
+        // Sticky releases count as pressed until polled, as with glfwGetKey
+        for (i = 0;  i < _GLFW_KEY_WORDS;  i++)
+            down[i] = window->keys.down[i] | window->keys.stuck[i];
+
+        memset(window->keys.stuck, 0, sizeof(window->keys.stuck));
     }
 
-    return (int) window->mouseButtons[button];
+    if (pressed)
+        memcpy(pressed, window->keys.pressed, sizeof(window->keys.pressed));
+    if (released)
+        memcpy(released, window->keys.released, sizeof(window->keys.released));
+}
+
+GLFWAPI void glfwGetMouseButtonState(GLFWwindow* handle,
+                                     uint32_t* down,
+                                     uint32_t* pressed,
+                                     uint32_t* released)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+
+    _GLFW_REQUIRE_INIT();
+
+    if (down)
+    {
+        *down = window->mouseButtons.down[0] | window->mouseButtons.stuck[0];
+        window->mouseButtons.stuck[0] = 0;
+    }
+
+    if (pressed)
+        *pressed = window->mouseButtons.pressed[0];
+    if (released)
+        *released = window->mouseButtons.released[0];
 }
 
 GLFWAPI void glfwGetCursorPos(GLFWwindow* handle, double* xpos, double* ypos)
@@ -333,7 +528,7 @@ GLFWAPI void glfwGetCursorPos(GLFWwindow* handle, double* xpos, double* ypos)
         if (ypos)
             *ypos = window->cursorPosY;
     }
-    else
+    else if (!window->offscreen)
         _glfwPlatformGetCursorPos(window, xpos, ypos);
 }
 
@@ -450,7 +645,8 @@ GLFWAPI void glfwSetCursor(GLFWwindow* windowHandle, GLFWcursor* cursorHandle)
 
     _GLFW_REQUIRE_INIT();
 
-    _glfwPlatformSetCursor(window, cursor);
+    if (!window->offscreen)
+        _glfwPlatformSetCursor(window, cursor);
 
     window->cursor = cursor;
 }
@@ -579,20 +775,172 @@ GLFWAPI const char* glfwGetJoystickName(int joy)
     return _glfwPlatformGetJoystickName(joy);
 }
 
+GLFWAPI double glfwGetJoystickTimestamp(int joy)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0.0);
+
+    if (joy < 0 || joy > GLFW_JOYSTICK_LAST)
+    {
+        _glfwInputError(GLFW_INVALID_ENUM, "Invalid joystick");
+        return 0.0;
+    }
+
+    return _glfwPlatformGetJoystickTimestamp(joy);
+}
+
+GLFWAPI int glfwGetJoystickEvents(int joy, GLFWjoystickevent* events, int count)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (joy < 0 || joy > GLFW_JOYSTICK_LAST)
+    {
+        _glfwInputError(GLFW_INVALID_ENUM, "Invalid joystick");
+        return 0;
+    }
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid event count");
+        return 0;
+    }
+
+    return _glfwPlatformGetJoystickEvents(joy, events, count);
+}
+
+GLFWAPI void glfwSetJoystickWakeup(int enabled)
+{
+    _GLFW_REQUIRE_INIT();
+    _glfwPlatformSetJoystickWakeup(enabled ? GL_TRUE : GL_FALSE);
+}
+
 GLFWAPI void glfwSetClipboardString(GLFWwindow* handle, const char* string)
 {
     _GLFWwindow* window = (_GLFWwindow*) handle;
+
     _GLFW_REQUIRE_INIT();
+
+    if (window->offscreen)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Offscreen windows cannot own the clipboard");
+        return;
+    }
+
     _glfwPlatformSetClipboardString(window, string);
 }
 
+GLFWAPI void glfwSetClipboardData(GLFWwindow* handle,
+                                  const char** types, int count,
+                                  void* data, size_t size,
+                                  GLFWclipboardfreefun cbfun)
+{
+    int i;
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+
+    // Ownership of the data is taken even on failure, so that the caller
+    // never has to work out whether to free it
+    if (!_glfwInitialized)
+    {
+        _glfwInputError(GLFW_NOT_INITIALIZED, NULL);
+        if (cbfun)
+            cbfun(data);
+
+        return;
+    }
+
+    if (window->offscreen)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Offscreen windows cannot own the clipboard");
+        if (cbfun)
+            cbfun(data);
+
+        return;
+    }
+
+    if (!types || count <= 0 || (!data && size))
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid clipboard data");
+        if (cbfun)
+            cbfun(data);
+
+        return;
+    }
+
+    for (i = 0;  i < count;  i++)
+    {
+        if (!types[i] || !*types[i])
+        {
+            _glfwInputError(GLFW_INVALID_VALUE, "Invalid clipboard MIME type");
+            if (cbfun)
+                cbfun(data);
+
+            return;
+        }
+    }
+
+    _glfwPlatformSetClipboardData(window, types, count, data, size, cbfun);
+}
+
 GLFWAPI const char* glfwGetClipboardString(GLFWwindow* handle)
 {
     _GLFWwindow* window = (_GLFWwindow*) handle;
+
     _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    if (window->offscreen)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Offscreen windows cannot receive the clipboard");
+        return NULL;
+    }
+
     return _glfwPlatformGetClipboardString(window);
 }
 
+GLFWAPI void glfwRequestClipboardString(GLFWwindow* handle, GLFWclipboardfun cbfun)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+
+    _GLFW_REQUIRE_INIT();
+
+    if (window->offscreen)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Offscreen windows cannot receive the clipboard");
+        return;
+    }
+
+    if (!cbfun)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid clipboard callback");
+        return;
+    }
+
+    // A pending request only has its callback replaced
+    if (window->callbacks.clipboard)
+    {
+        window->callbacks.clipboard = cbfun;
+        return;
+    }
+
+    window->callbacks.clipboard = cbfun;
+    _glfwPlatformRequestClipboardString(window);
+}
+
+GLFWAPI void glfwSetClipboardTimeout(double timeout)
+{
+    _GLFW_REQUIRE_INIT();
+
+    if (timeout != timeout || timeout < 0.0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid time %f", timeout);
+        return;
+    }
+
+    _glfw.clipboardTimeout = timeout;
+}
+
 GLFWAPI double glfwGetTime(void)
 {
     _GLFW_REQUIRE_INIT_OR_RETURN(0.0);
@@ -612,3 +960,13 @@ GLFWAPI void glfwSetTime(double time)
     _glfwPlatformSetTime(time);
 }
 
+GLFWAPI double glfwGetEventTime(void)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0.0);
+
+    if (_glfw.eventTime)
+        return _glfw.eventTime;
+
+    return _glfwPlatformGetTime();
+}
+
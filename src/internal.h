@@ -76,6 +76,28 @@ typedef struct _GLFWwindow      _GLFWwindow;
 typedef struct _GLFWlibrary     _GLFWlibrary;
 typedef struct _GLFWmonitor     _GLFWmonitor;
 typedef struct _GLFWcursor      _GLFWcursor;
+typedef struct _GLFWmutex       _GLFWmutex;
+typedef struct _GLFWcontextpool _GLFWcontextpool;
+typedef struct _GLFWextset      _GLFWextset;
+typedef struct _GLFWprocentry   _GLFWprocentry;
+typedef struct _GLFWwatch       _GLFWwatch;
+typedef struct _GLFWusercell    _GLFWusercell;
+
+/*! @brief Extension name set.
+ *
+ *  A hash set of extension names, parsed once from an extension string so that
+ *  extension queries take constant time.  This is defined before the platform
+ *  headers as the context APIs keep sets of their own extensions.
+ */
+struct _GLFWextset
+{
+    // Copy of all extension names, each null terminated
+    char*           names;
+    // Open addressing hash table of pointers into names
+    const char**    slots;
+    // Number of slots, a power of two, or zero if the set is not built
+    unsigned int    size;
+};
 
 #if defined(_GLFW_COCOA)
  #include "cocoa_platform.h"
@@ -137,6 +159,25 @@ typedef struct _GLFWcursor      _GLFWcursor;
         return x;                                    \
     }
 
+// Number of framebuffer config selections remembered
+#define _GLFW_FBCONFIG_CACHE_SIZE 8
+
+// Capacity of the user event queue, which must be a power of two
+#define _GLFW_USER_EVENT_COUNT 4096
+
+// Default time, in seconds, to wait for the clipboard owner
+#define _GLFW_CLIPBOARD_TIMEOUT 1.0
+
+// Sizes of the key and mouse button bitsets, in 32-bit words
+#define _GLFW_KEY_WORDS GLFW_KEYBOARD_STATE_WORDS
+#define _GLFW_MOUSE_BUTTON_WORDS ((GLFW_MOUSE_BUTTON_LAST + 32) / 32)
+
+// Accesses single bits of a bitset stored as an array of 32-bit words
+#define _GLFW_BIT(i) ((uint32_t) 1 << ((i) & 31))
+#define _GLFW_GET_BIT(bits, i) (((bits)[(i) >> 5] & _GLFW_BIT(i)) != 0)
+#define _GLFW_SET_BIT(bits, i) ((bits)[(i) >> 5] |= _GLFW_BIT(i))
+#define _GLFW_CLEAR_BIT(bits, i) ((bits)[(i) >> 5] &= ~_GLFW_BIT(i))
+
 // Swaps the provided pointers
 #define _GLFW_SWAP_POINTERS(x, y) \
     {                             \
@@ -168,6 +209,7 @@ struct _GLFWwndconfig
     GLboolean     focused;
     GLboolean     autoIconify;
     GLboolean     floating;
+    GLboolean     offscreen;
     _GLFWmonitor* monitor;
 };
 
@@ -234,19 +276,44 @@ struct _GLFWwindow
     GLboolean           decorated;
     GLboolean           autoIconify;
     GLboolean           floating;
+    GLboolean           offscreen;
     GLboolean           closed;
+    // Whether the window is being destroyed and must not be reported
+    GLboolean           destroying;
     void*               userPointer;
     GLFWvidmode         videoMode;
     _GLFWmonitor*       monitor;
     _GLFWcursor*        cursor;
+    // Pool owning this window, if any
+    _GLFWcontextpool*   pool;
+    GLboolean           acquired;
 
     // Window input state
     GLboolean           stickyKeys;
     GLboolean           stickyMouseButtons;
+    GLboolean           coalesceMotion;
     double              cursorPosX, cursorPosY;
+    // Coalesced cursor motion not yet delivered to the callback
+    GLboolean           motionPending;
+    double              motionPosX, motionPosY;
+    double              motionTime;
     int                 cursorMode;
-    char                mouseButtons[GLFW_MOUSE_BUTTON_LAST + 1];
-    char                keys[GLFW_KEY_LAST + 1];
+
+    // Key and mouse button states as bitsets indexed by key or button, with
+    // stuck bits for sticky releases not yet polled and edge bits for changes
+    // during the last event processing pass
+    struct {
+        uint32_t        down[_GLFW_KEY_WORDS];
+        uint32_t        stuck[_GLFW_KEY_WORDS];
+        uint32_t        pressed[_GLFW_KEY_WORDS];
+        uint32_t        released[_GLFW_KEY_WORDS];
+    } keys;
+    struct {
+        uint32_t        down[_GLFW_MOUSE_BUTTON_WORDS];
+        uint32_t        stuck[_GLFW_MOUSE_BUTTON_WORDS];
+        uint32_t        pressed[_GLFW_MOUSE_BUTTON_WORDS];
+        uint32_t        released[_GLFW_MOUSE_BUTTON_WORDS];
+    } mouseButtons;
 
     // OpenGL extensions and context attributes
     struct {
@@ -261,6 +328,25 @@ struct _GLFWwindow
 #if defined(_GLFW_USE_OPENGL)
     PFNGLGETSTRINGIPROC GetStringi;
 #endif
+    _GLFWextset         extensions;
+
+    // Most recently completed buffer swap and the interval it was made with
+    GLFWframetiming     frame;
+    int                 swapInterval;
+
+    // Frame pacing state and statistics, see glfwWaitForFrame
+    struct {
+        GLboolean       started;
+        double          anchor;
+        double          monitorPeriod;
+        double          vblank;
+        double          wakeTime;
+        int             frameCount;
+        int             missedDeadlines;
+        double          meanFrameTime, squaredDeviations;
+        double          minFrameTime, maxFrameTime;
+        double          totalWakeLatency, maxWakeLatency;
+    } pacing;
 
     struct {
         GLFWwindowposfun        pos;
@@ -278,6 +364,8 @@ struct _GLFWwindow
         GLFWcharfun             character;
         GLFWcharmodsfun         charmods;
         GLFWdropfun             drop;
+        // Callback of the pending clipboard request, if any
+        GLFWclipboardfun        clipboard;
     } callbacks;
 
     // This is defined in the window API's platform.h
@@ -318,6 +406,63 @@ struct _GLFWcursor
     _GLFW_PLATFORM_CURSOR_STATE;
 };
 
+/*! @brief Mutex structure.
+ */
+struct _GLFWmutex
+{
+    // This is defined in the platform's tls.h
+    _GLFW_PLATFORM_MUTEX_STATE;
+};
+
+
+/*! @brief Shared context pool structure.
+ */
+struct _GLFWcontextpool
+{
+    _GLFWcontextpool*   next;
+
+    // All windows of the pool
+    _GLFWwindow**       windows;
+    int                 count;
+    // Stack of windows not currently acquired, guarded by the mutex
+    _GLFWwindow**       available;
+    int                 availableCount;
+    _GLFWmutex          mutex;
+};
+
+
+/*! @brief Client API function pointer cache entry.
+ */
+struct _GLFWprocentry
+{
+    char*           name;
+    unsigned int    hash;
+    GLFWglproc      proc;
+};
+
+
+/*! @brief Watched file descriptor.
+ */
+struct _GLFWwatch
+{
+    int             fd;
+    int             events;
+    GLFWfdfun       callback;
+};
+
+
+/*! @brief User event queue cell.
+ *
+ *  The sequence number tells producers and the consumer whose turn it is to
+ *  use the cell, which makes the queue lock-free.
+ */
+struct _GLFWusercell
+{
+    volatile unsigned int sequence;
+    void*           payload;
+};
+
+
 /*! @brief Library global data.
  */
 struct _GLFWlibrary
@@ -333,14 +478,62 @@ struct _GLFWlibrary
 
     _GLFWcursor*        cursorListHead;
 
+    _GLFWcontextpool*   contextPoolListHead;
+
+    // Client API function pointers retrieved so far, if the context API allows
+    // caching them, guarded by the mutex
+    struct {
+        _GLFWprocentry* entries;
+        unsigned int    size;
+        unsigned int    count;
+        _GLFWmutex      mutex;
+    } procCache;
+
     _GLFWwindow*        windowListHead;
     _GLFWwindow*        focusedWindow;
 
+    // File descriptors watched by event processing
+    _GLFWwatch*         watches;
+    int                 watchCount;
+
     _GLFWmonitor**      monitors;
     int                 monitorCount;
 
+    // Recent framebuffer config selections of the context API
+    struct {
+        _GLFWfbconfig        desired;
+        const _GLFWfbconfig* alternatives;
+        const _GLFWfbconfig* closest;
+    } fbconfigCache[_GLFW_FBCONFIG_CACHE_SIZE];
+    int                 fbconfigCacheCount;
+    int                 fbconfigCacheNext;
+
+    // Bounded queue of user events from any thread to the main thread, with
+    // the producer and consumer positions kept apart by the cells
+    struct {
+        volatile unsigned int enqueuePos;
+        _GLFWusercell   cells[_GLFW_USER_EVENT_COUNT];
+        unsigned int    dequeuePos;
+        // Whether a wakeup has been posted since the queue was last drained
+        volatile unsigned int wakeup;
+    } userEvents;
+
+    struct {
+        // Caller-provided event buffer, or NULL to use callbacks
+        GLFWevent*      buffer;
+        int             size;
+        int             count;
+    } events;
+
+    // Time of the window system event being processed, or zero if unknown
+    double              eventTime;
+
+    // Time to wait for the clipboard owner, or zero to wait indefinitely
+    double              clipboardTimeout;
+
     struct {
         GLFWmonitorfun  monitor;
+        GLFWusereventfun userEvent;
     } callbacks;
 
     // This is defined in the window API's platform.h
@@ -353,6 +546,10 @@ struct _GLFWlibrary
     _GLFW_PLATFORM_LIBRARY_JOYSTICK_STATE;
     // This is defined in the platform's tls.h
     _GLFW_PLATFORM_LIBRARY_TLS_STATE;
+#if defined(_GLFW_PLATFORM_LIBRARY_WAIT_STATE)
+    // This is defined in the platform's wait.h, where there is one
+    _GLFW_PLATFORM_LIBRARY_WAIT_STATE;
+#endif
 };
 
 
@@ -455,6 +652,17 @@ void _glfwPlatformSetGammaRamp(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
  */
 void _glfwPlatformSetClipboardString(_GLFWwindow* window, const char* string);
 
+/*! @copydoc glfwSetClipboardData
+ *  @ingroup platform
+ *
+ *  @note The free function, if any, must be called exactly once, including
+ *  when this function fails.
+ */
+void _glfwPlatformSetClipboardData(_GLFWwindow* window,
+                                   const char** types, int count,
+                                   void* data, size_t size,
+                                   GLFWclipboardfreefun cbfun);
+
 /*! @copydoc glfwGetClipboardString
  *  @ingroup platform
  *
@@ -463,6 +671,15 @@ void _glfwPlatformSetClipboardString(_GLFWwindow* window, const char* string);
  */
 const char* _glfwPlatformGetClipboardString(_GLFWwindow* window);
 
+/*! @brief Starts retrieving the contents of the clipboard.
+ *  @param[in] window The window that will request the clipboard contents.
+ *  @ingroup platform
+ *
+ *  @note The request is completed by calling @ref _glfwInputClipboardString,
+ *  which may happen before this function returns.
+ */
+void _glfwPlatformRequestClipboardString(_GLFWwindow* window);
+
 /*! @copydoc glfwJoystickPresent
  *  @ingroup platform
  */
@@ -483,6 +700,16 @@ const unsigned char* _glfwPlatformGetJoystickButtons(int joy, int* count);
  */
 const char* _glfwPlatformGetJoystickName(int joy);
 
+/*! @copydoc glfwGetJoystickTimestamp
+ *  @ingroup platform
+ */
+double _glfwPlatformGetJoystickTimestamp(int joy);
+
+/*! @copydoc glfwGetJoystickEvents
+ *  @ingroup platform
+ */
+int _glfwPlatformGetJoystickEvents(int joy, GLFWjoystickevent* events, int count);
+
 /*! @copydoc glfwGetTime
  *  @ingroup platform
  */
@@ -493,6 +720,12 @@ double _glfwPlatformGetTime(void);
  */
 void _glfwPlatformSetTime(double time);
 
+/*! @brief Suspends the calling thread until the specified time.
+ *  @param[in] time The time, on the GLFW timer, to sleep until.
+ *  @ingroup platform
+ */
+void _glfwPlatformSleepUntil(double time);
+
 /*! @ingroup platform
  */
 int _glfwPlatformCreateWindow(_GLFWwindow* window,
@@ -588,6 +821,30 @@ void _glfwPlatformPollEvents(void);
  */
 void _glfwPlatformWaitEvents(void);
 
+/*! @copydoc glfwWaitEventsTimeout
+ *  @ingroup platform
+ */
+void _glfwPlatformWaitEventsTimeout(double timeout);
+
+/*! @brief Starts or updates the watch of a file descriptor.
+ *  @param[in] fd The file descriptor to watch.
+ *  @param[in] events The events to watch for.
+ *  @return `GL_TRUE` if successful, or `GL_FALSE` if an error occurred.
+ *  @ingroup platform
+ */
+int _glfwPlatformWatchFileDescriptor(int fd, int events);
+
+/*! @brief Stops watching a file descriptor.
+ *  @param[in] fd The file descriptor to stop watching.
+ *  @ingroup platform
+ */
+void _glfwPlatformUnwatchFileDescriptor(int fd);
+
+/*! @copydoc glfwSetJoystickWakeup
+ *  @ingroup platform
+ */
+void _glfwPlatformSetJoystickWakeup(int enabled);
+
 /*! @copydoc glfwPostEmptyEvent
  *  @ingroup platform
  */
@@ -613,6 +870,14 @@ void _glfwPlatformSwapBuffers(_GLFWwindow* window);
  */
 void _glfwPlatformSwapInterval(int interval);
 
+/*! @brief Updates the frame timing of the specified window.
+ *  @param[in] window The window to query.
+ *  @return `GL_TRUE` if frame timing is available for the window, or
+ *  `GL_FALSE` otherwise.
+ *  @ingroup platform
+ */
+int _glfwPlatformGetFrameTiming(_GLFWwindow* window);
+
 /*! @copydoc glfwExtensionSupported
  *  @ingroup platform
  */
@@ -693,6 +958,25 @@ void _glfwInputWindowIconify(_GLFWwindow* window, int iconified);
  */
 void _glfwInputWindowDamage(_GLFWwindow* window);
 
+/*! @brief Notifies shared code of a completed buffer swap.
+ *  @param[in] window The window whose buffers were swapped.
+ *  @param[in] ust The unadjusted system time at which the swap was presented.
+ *  @param[in] msc The media stream counter at which the swap was presented.
+ *  @param[in] sbc The swap buffer counter of the swap.
+ *  @param[in] time The present time on the GLFW timer, or zero if unknown.
+ *  @ingroup event
+ */
+void _glfwInputFrameTiming(_GLFWwindow* window,
+                           uint64_t ust, uint64_t msc, uint64_t sbc,
+                           double time);
+
+/*! @brief Notifies shared code that a watched file descriptor is ready.
+ *  @param[in] fd The file descriptor that is ready.
+ *  @param[in] events The events that occurred.
+ *  @ingroup event
+ */
+void _glfwInputFileDescriptor(int fd, int events);
+
 /*! @brief Notifies shared code of a window close request event
  *  @param[in] window The window that received the event.
  *  @ingroup event
@@ -753,6 +1037,11 @@ void _glfwInputCursorMotion(_GLFWwindow* window, double x, double y);
  */
 void _glfwInputCursorEnter(_GLFWwindow* window, int entered);
 
+/*! @brief Delivers any coalesced cursor motion of all windows.
+ *  @ingroup event
+ */
+void _glfwFlushCursorMotion(void);
+
 /*! @ingroup event
  */
 void _glfwInputMonitorChange(void);
@@ -773,6 +1062,24 @@ void _glfwInputError(int error, const char* format, ...);
  */
 void _glfwInputDrop(_GLFWwindow* window, int count, const char** names);
 
+/*! @brief Notifies shared code of the time of the event being processed.
+ *  @param[in] time The time, on the GLFW timer, at which the window system
+ *  received the event, or zero if it is unknown.
+ *  @ingroup event
+ *
+ *  @remarks This applies to all events reported until it is called again, so
+ *  it should be called for every window system event.
+ */
+void _glfwInputEventTime(double time);
+
+/*! @brief Notifies shared code of the completion of a clipboard request.
+ *  @param[in] window The window that requested the clipboard contents.
+ *  @param[in] string The contents of the clipboard, or `NULL` if the request
+ *  failed.
+ *  @ingroup event
+ */
+void _glfwInputClipboardString(_GLFWwindow* window, const char* string);
+
 
 //========================================================================
 // Utility functions
@@ -801,6 +1108,26 @@ void _glfwSplitBPP(int bpp, int* red, int* green, int* blue);
  */
 int _glfwStringInExtensionString(const char* string, const GLubyte* extensions);
 
+/*! @brief Builds an extension set from an extension string.
+ *  @param[in] set The set to build.
+ *  @param[in] extensions The space separated extension names to add, or `NULL`.
+ *  @ingroup utility
+ */
+void _glfwInitExtensionSet(_GLFWextset* set, const char* extensions);
+
+/*! @brief Frees an extension set and any data associated with it.
+ *  @ingroup utility
+ */
+void _glfwFreeExtensionSet(_GLFWextset* set);
+
+/*! @brief Searches an extension set for the specified extension.
+ *  @param[in] set The extension set to search.
+ *  @param[in] extension The extension to search for.
+ *  @return `GL_TRUE` if the extension was found, or `GL_FALSE` otherwise.
+ *  @ingroup utility
+ */
+int _glfwExtensionSetContains(const _GLFWextset* set, const char* extension);
+
 /*! @brief Chooses the framebuffer config that best matches the desired one.
  *  @param[in] desired The desired framebuffer config.
  *  @param[in] alternatives The framebuffer configs supported by the system.
@@ -813,6 +1140,20 @@ const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
                                          const _GLFWfbconfig* alternatives,
                                          unsigned int count);
 
+/*! @brief Chooses the framebuffer config that best matches the desired one,
+ *  reusing the result of an earlier identical selection.
+ *  @param[in] desired The desired framebuffer config.
+ *  @param[in] alternatives The framebuffer configs supported by the system.
+ *  This array must remain unchanged until the library is terminated.
+ *  @param[in] count The number of entries in the alternatives array.
+ *  @return The framebuffer config most closely matching the desired one, or @c
+ *  NULL if none fulfilled the hard constraints of the desired values.
+ *  @ingroup utility
+ */
+const _GLFWfbconfig* _glfwChooseCachedFBConfig(const _GLFWfbconfig* desired,
+                                               const _GLFWfbconfig* alternatives,
+                                               unsigned int count);
+
 /*! @brief Retrieves the attributes of the current context.
  *  @param[in] ctxconfig The desired context attributes.
  *  @return `GL_TRUE` if successful, or `GL_FALSE` if the context is unusable.
@@ -841,6 +1182,32 @@ GLboolean _glfwIsValidContextConfig(const _GLFWctxconfig* ctxconfig);
  */
 GLboolean _glfwIsValidContext(const _GLFWctxconfig* ctxconfig);
 
+/*! @brief Initializes the client API function pointer cache.
+ *  @return `GL_TRUE` if successful, or `GL_FALSE` if an error occurred.
+ *  @ingroup utility
+ */
+GLboolean _glfwInitProcCache(void);
+
+/*! @brief Frees the client API function pointer cache.
+ *  @ingroup utility
+ */
+void _glfwTerminateProcCache(void);
+
+/*! @brief Creates a window and its context from validated configs.
+ *  @param[in] wndconfig The desired window attributes.
+ *  @param[in] ctxconfig The desired context attributes.
+ *  @param[in] fbconfig The desired framebuffer attributes.
+ *  @param[in] model A window created earlier from identical configs whose
+ *  context attributes to copy instead of reading them back from the new
+ *  context, or `NULL`.
+ *  @return The newly created window, or `NULL` if an error occurred.
+ *  @ingroup utility
+ */
+_GLFWwindow* _glfwCreateWindow(const _GLFWwndconfig* wndconfig,
+                               const _GLFWctxconfig* ctxconfig,
+                               const _GLFWfbconfig* fbconfig,
+                               const _GLFWwindow* model);
+
 /*! @ingroup utility
  */
 void _glfwAllocGammaArrays(GLFWgammaramp* ramp, unsigned int size);
@@ -868,4 +1235,18 @@ void _glfwFreeMonitor(_GLFWmonitor* monitor);
   */
 void _glfwFreeMonitors(_GLFWmonitor** monitors, int count);
 
+/*! @brief Prepares the user event queue for use.
+ *  @ingroup utility
+ */
+void _glfwInitUserEvents(void);
+
+/*! @brief Allocates a record in the event buffer.
+ *  @param[in] window The window that received the event.
+ *  @param[in] type The type of the event.
+ *  @return The record to fill in, or `NULL` if the event should be passed to
+ *  its callback.
+ *  @ingroup utility
+ */
+GLFWevent* _glfwBufferEvent(_GLFWwindow* window, int type);
+
 #endif // _glfw3_internal_h_
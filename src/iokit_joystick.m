@@ -504,3 +504,20 @@ const char* _glfwPlatformGetJoystickName(int joy)
     return _glfw.iokit_js[joy].name;
 }
 
+double _glfwPlatformGetJoystickTimestamp(int joy)
+{
+    pollJoystickEvents();
+
+    // IOKit joystick state is sampled when queried
+    if (!_glfw.iokit_js[joy].present)
+        return 0.0;
+
+    return _glfwPlatformGetTime();
+}
+
+int _glfwPlatformGetJoystickEvents(int joy, GLFWjoystickevent* events, int count)
+{
+    // Joystick state is sampled when queried, so there is no event history
+    return 0;
+}
+
@@ -28,18 +28,171 @@
 #include "internal.h"
 
 #if defined(__linux__)
-#include <linux/joystick.h>
+#include <linux/input.h>
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/ioctl.h>
 #include <sys/inotify.h>
+#include <sys/epoll.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <dirent.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
+
+// The epoll tag used for the inotify descriptor, as joystick descriptors are
+// tagged with their slot index
+#define _GLFW_INOTIFY_TAG (GLFW_JOYSTICK_LAST + 1)
+
+// The number of evdev events read per read(2) call
+#define _GLFW_EVENT_BUFFER_SIZE 64
+
+// The capacity of the per-joystick event buffer, which must be a power of two
+#define _GLFW_JOYSTICK_EVENT_COUNT 1024
+
+// The number of longs needed to hold the specified number of bits
+#define _GLFW_BIT_LONGS(n) (((n) + 8 * sizeof(long) - 1) / (8 * sizeof(long)))
+
+// Returns whether the specified bit is set in an evdev bit array
+//
+static GLboolean isBitSet(int bit, const unsigned long* bits)
+{
+    return (bits[bit / (8 * sizeof(long))] >> (bit % (8 * sizeof(long)))) & 1;
+}
+
+// Returns whether the device capabilities describe a joystick or gamepad
+// This mirrors the device matching done by the kernel joydev driver
+//
+static GLboolean isJoystickDevice(const unsigned long* evBits,
+                                  const unsigned long* keyBits,
+                                  const unsigned long* absBits)
+{
+    int code;
+
+    if (!isBitSet(EV_KEY, evBits) || !isBitSet(EV_ABS, evBits))
+        return GL_FALSE;
+
+    if (!isBitSet(ABS_X, absBits) && !isBitSet(ABS_WHEEL, absBits) &&
+        !isBitSet(ABS_THROTTLE, absBits))
+    {
+        return GL_FALSE;
+    }
+
+    for (code = BTN_JOYSTICK;  code < BTN_DIGI;  code++)
+    {
+        if (isBitSet(code, keyBits))
+            return GL_TRUE;
+    }
+
+    for (code = BTN_TRIGGER_HAPPY;  code <= BTN_TRIGGER_HAPPY40;  code++)
+    {
+        if (isBitSet(code, keyBits))
+            return GL_TRUE;
+    }
+
+    return GL_FALSE;
+}
+
+// Updates the axis mapping of the specified absolute axis from its range
+//
+static void setAxisRange(int joy, int code, const struct input_absinfo* info)
+{
+    const float range = (float) info->maximum - (float) info->minimum;
+
+    if (range == 0.f)
+    {
+        _glfw.linux_js.js[joy].absScale[code] = 0.f;
+        _glfw.linux_js.js[joy].absBias[code] = 0.f;
+        return;
+    }
+
+    _glfw.linux_js.js[joy].absScale[code] = 2.f / range;
+    _glfw.linux_js.js[joy].absBias[code] =
+        -1.f - (float) info->minimum * _glfw.linux_js.js[joy].absScale[code];
+}
+
+// Appends an axis or button change to the event buffer of the specified
+// joystick, discarding it if the buffer is full
+//
+static void pushJoystickEvent(int joy, int type, int index, float value)
+{
+    GLFWjoystickevent* event;
+    const unsigned int head = _glfw.linux_js.js[joy].eventHead;
+
+    if (!_glfw.linux_js.js[joy].events)
+        return;
+
+    if (head - _glfw.linux_js.js[joy].eventTail == _GLFW_JOYSTICK_EVENT_COUNT)
+        return;
+
+    event = _glfw.linux_js.js[joy].events +
+            (head & (_GLFW_JOYSTICK_EVENT_COUNT - 1));
+    event->time = _glfw.linux_js.js[joy].timestamp;
+    event->type = type;
+    event->index = index;
+    event->value = value;
+
+    // The producer only ever writes the head and the consumer the tail
+    _glfw.linux_js.js[joy].eventHead = head + 1;
+}
+
+// Re-reads the complete button and axis state of the specified joystick
+// This is done for the initial state and to recover from dropped events
+//
+static void syncJoystickState(int joy)
+{
+    int code;
+    unsigned long keyBits[_GLFW_BIT_LONGS(KEY_CNT)];
+    const int fd = _glfw.linux_js.js[joy].fd;
+
+    _glfw.linux_js.js[joy].timestamp = _glfwPlatformGetTime();
+
+    memset(keyBits, 0, sizeof(keyBits));
+    ioctl(fd, EVIOCGKEY(sizeof(keyBits)), keyBits);
+
+    for (code = BTN_MISC;  code < KEY_CNT;  code++)
+    {
+        unsigned char state;
+        const int index = _glfw.linux_js.js[joy].keyMap[code - BTN_MISC];
+        if (index < 0)
+            continue;
+
+        state = isBitSet(code, keyBits) ? GLFW_PRESS : GLFW_RELEASE;
+        if (_glfw.linux_js.js[joy].buttons[index] == state)
+            continue;
+
+        _glfw.linux_js.js[joy].buttons[index] = state;
+        pushJoystickEvent(joy, GLFW_JOYSTICK_BUTTON, index, state);
+    }
+
+    for (code = 0;  code < ABS_CNT;  code++)
+    {
+        float value;
+        struct input_absinfo info;
+        const int index = _glfw.linux_js.js[joy].absMap[code];
+        if (index < 0)
+            continue;
+
+        if (ioctl(fd, EVIOCGABS(code), &info) < 0)
+            continue;
+
+        setAxisRange(joy, code, &info);
+
+        value = (float) info.value * _glfw.linux_js.js[joy].absScale[code] +
+                _glfw.linux_js.js[joy].absBias[code];
+        if (_glfw.linux_js.js[joy].axes[index] == value)
+            continue;
+
+        _glfw.linux_js.js[joy].axes[index] = value;
+        pushJoystickEvent(joy, GLFW_JOYSTICK_AXIS, index, value);
+    }
+}
+
 #endif // __linux__
 
 
@@ -48,9 +201,12 @@
 static void openJoystickDevice(const char* path)
 {
 #if defined(__linux__)
-    char axisCount, buttonCount;
+    unsigned long evBits[_GLFW_BIT_LONGS(EV_CNT)];
+    unsigned long keyBits[_GLFW_BIT_LONGS(KEY_CNT)];
+    unsigned long absBits[_GLFW_BIT_LONGS(ABS_CNT)];
     char name[256];
-    int joy, fd, version;
+    int joy, fd, code;
+    struct epoll_event event;
 
     for (joy = GLFW_JOYSTICK_1;  joy <= GLFW_JOYSTICK_LAST;  joy++)
     {
@@ -70,47 +226,120 @@ static void openJoystickDevice(const char* path)
     if (joy > GLFW_JOYSTICK_LAST)
         return;
 
-    fd = open(path, O_RDONLY | O_NONBLOCK);
+    fd = open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
     if (fd == -1)
         return;
 
-    _glfw.linux_js.js[joy].fd = fd;
+    memset(evBits, 0, sizeof(evBits));
+    memset(keyBits, 0, sizeof(keyBits));
+    memset(absBits, 0, sizeof(absBits));
 
-    // Verify that the joystick driver version is at least 1.0
-    ioctl(fd, JSIOCGVERSION, &version);
-    if (version < 0x010000)
+    if (ioctl(fd, EVIOCGBIT(0, sizeof(evBits)), evBits) < 0 ||
+        ioctl(fd, EVIOCGBIT(EV_KEY, sizeof(keyBits)), keyBits) < 0 ||
+        ioctl(fd, EVIOCGBIT(EV_ABS, sizeof(absBits)), absBits) < 0)
     {
-        // It's an old 0.x interface (we don't support it)
         close(fd);
         return;
     }
 
-    if (ioctl(fd, JSIOCGNAME(sizeof(name)), name) < 0)
+    // Event devices are also created for keyboards, mice, touchpads, etc.
+    if (!isJoystickDevice(evBits, keyBits, absBits))
+    {
+        close(fd);
+        return;
+    }
+
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.u32 = joy;
+
+    if (epoll_ctl(_glfw.linux_js.epoll, EPOLL_CTL_ADD, fd, &event) == -1)
+    {
+        close(fd);
+        return;
+    }
+
+    _glfw.linux_js.js[joy].fd = fd;
+
+#if defined(CLOCK_MONOTONIC)
+    if (_glfw.posix_time.monotonic)
+    {
+        // Ask for event timestamps on the same clock as the GLFW timer
+        int clock = CLOCK_MONOTONIC;
+        if (ioctl(fd, EVIOCSCLOCKID, &clock) == 0)
+            _glfw.linux_js.js[joy].kernelTime = GL_TRUE;
+    }
+    else
+#endif
+        _glfw.linux_js.js[joy].kernelTime = GL_TRUE;
+
+    if (ioctl(fd, EVIOCGNAME(sizeof(name)), name) < 0)
         strncpy(name, "Unknown", sizeof(name));
 
     _glfw.linux_js.js[joy].name = strdup(name);
     _glfw.linux_js.js[joy].path = strdup(path);
 
-    ioctl(fd, JSIOCGAXES, &axisCount);
-    _glfw.linux_js.js[joy].axisCount = (int) axisCount;
+    for (code = BTN_MISC;  code < KEY_CNT;  code++)
+    {
+        if (isBitSet(code, keyBits))
+        {
+            _glfw.linux_js.js[joy].keyMap[code - BTN_MISC] =
+                _glfw.linux_js.js[joy].buttonCount++;
+        }
+        else
+            _glfw.linux_js.js[joy].keyMap[code - BTN_MISC] = -1;
+    }
 
-    ioctl(fd, JSIOCGBUTTONS, &buttonCount);
-    _glfw.linux_js.js[joy].buttonCount = (int) buttonCount;
+    for (code = 0;  code < ABS_CNT;  code++)
+    {
+        if (isBitSet(code, absBits))
+        {
+            _glfw.linux_js.js[joy].absMap[code] =
+                _glfw.linux_js.js[joy].axisCount++;
+        }
+        else
+            _glfw.linux_js.js[joy].absMap[code] = -1;
+    }
+
+    _glfw.linux_js.js[joy].axes =
+        calloc(_glfw.linux_js.js[joy].axisCount, sizeof(float));
+    _glfw.linux_js.js[joy].buttons =
+        calloc(_glfw.linux_js.js[joy].buttonCount, 1);
+
+    // Unlike the joydev interface, evdev sends no initial state events
+    syncJoystickState(joy);
 
-    _glfw.linux_js.js[joy].axes = calloc(axisCount, sizeof(float));
-    _glfw.linux_js.js[joy].buttons = calloc(buttonCount, 1);
+    // The event buffer is created after the initial state is read, so that
+    // only actual changes are reported
+    _glfw.linux_js.js[joy].events =
+        calloc(_GLFW_JOYSTICK_EVENT_COUNT, sizeof(GLFWjoystickevent));
 
     _glfw.linux_js.js[joy].present = GL_TRUE;
 #endif // __linux__
 }
 
-// Polls for and processes events for all present joysticks
+#if defined(__linux__)
+
+// Frees all resources associated with the specified joystick slot
 //
-static void pollJoystickEvents(void)
+static void closeJoystickDevice(int joy)
+{
+    // Closing the descriptor also removes it from the epoll set
+    close(_glfw.linux_js.js[joy].fd);
+
+    free(_glfw.linux_js.js[joy].axes);
+    free(_glfw.linux_js.js[joy].buttons);
+    free(_glfw.linux_js.js[joy].name);
+    free(_glfw.linux_js.js[joy].path);
+    free(_glfw.linux_js.js[joy].events);
+
+    memset(&_glfw.linux_js.js[joy], 0, sizeof(_glfw.linux_js.js[joy]));
+}
+
+// Processes pending device notifications from inotify
+//
+static void handleDeviceNotifications(void)
 {
-#if defined(__linux__)
-    int i;
-    struct js_event e;
     ssize_t offset = 0;
     char buffer[16384];
 
@@ -123,63 +352,131 @@ static void pollJoystickEvents(void)
 
         if (regexec(&_glfw.linux_js.regex, e->name, 1, &match, 0) == 0)
         {
-            char path[20];
+            char path[PATH_MAX];
             snprintf(path, sizeof(path), "/dev/input/%s", e->name);
             openJoystickDevice(path);
         }
 
         offset += sizeof(struct inotify_event) + e->len;
     }
+}
 
-    for (i = 0;  i <= GLFW_JOYSTICK_LAST;  i++)
+// Applies a single evdev event to the state of the specified joystick
+//
+static void handleEvent(int joy, const struct input_event* e)
+{
+    int index;
+
+    if (e->type == EV_SYN)
     {
-        if (!_glfw.linux_js.js[i].present)
-            continue;
+        if (e->code == SYN_DROPPED)
+        {
+            // The kernel event buffer overflowed, so all events up to and
+            // including the next SYN_REPORT must be discarded
+            _glfw.linux_js.js[joy].dropped = GL_TRUE;
+        }
+        else if (e->code == SYN_REPORT && _glfw.linux_js.js[joy].dropped)
+        {
+            _glfw.linux_js.js[joy].dropped = GL_FALSE;
+            syncJoystickState(joy);
+        }
+
+        return;
+    }
 
-        // Read all queued events (non-blocking)
-        for (;;)
+    if (_glfw.linux_js.js[joy].dropped)
+        return;
+
+    if (e->type == EV_KEY)
+    {
+        if (e->code < BTN_MISC || e->code >= KEY_CNT)
+            return;
+
+        index = _glfw.linux_js.js[joy].keyMap[e->code - BTN_MISC];
+        if (index < 0)
+            return;
+    }
+    else if (e->type == EV_ABS)
+    {
+        if (e->code >= ABS_CNT)
+            return;
+
+        index = _glfw.linux_js.js[joy].absMap[e->code];
+        if (index < 0)
+            return;
+    }
+    else
+        return;
+
+    if (_glfw.linux_js.js[joy].kernelTime)
+    {
+#if defined(input_event_sec)
+        _glfw.linux_js.js[joy].timestamp =
+            _glfwConvertTimestamp(e->input_event_sec,
+                                  e->input_event_usec * 1000);
+#else
+        _glfw.linux_js.js[joy].timestamp =
+            _glfwConvertTimestamp(e->time.tv_sec,
+                                  e->time.tv_usec * 1000);
+#endif
+    }
+    else
+        _glfw.linux_js.js[joy].timestamp = _glfwPlatformGetTime();
+
+    if (e->type == EV_KEY)
+    {
+        // Key repeat (value 2) is reported as a continued press
+        const unsigned char state = e->value ? GLFW_PRESS : GLFW_RELEASE;
+        if (_glfw.linux_js.js[joy].buttons[index] == state)
+            return;
+
+        _glfw.linux_js.js[joy].buttons[index] = state;
+        pushJoystickEvent(joy, GLFW_JOYSTICK_BUTTON, index, state);
+    }
+    else
+    {
+        const float value =
+            (float) e->value * _glfw.linux_js.js[joy].absScale[e->code] +
+            _glfw.linux_js.js[joy].absBias[e->code];
+
+        _glfw.linux_js.js[joy].axes[index] = value;
+        pushJoystickEvent(joy, GLFW_JOYSTICK_AXIS, index, value);
+    }
+}
+
+// Reads all queued events for the specified joystick
+//
+static void handleJoystickEvents(int joy)
+{
+    struct input_event events[_GLFW_EVENT_BUFFER_SIZE];
+
+    // Read all queued events in bulk (non-blocking)
+    for (;;)
+    {
+        ssize_t i, count;
+        const ssize_t size = read(_glfw.linux_js.js[joy].fd,
+                                  events, sizeof(events));
+        if (size < 0)
         {
-            errno = 0;
-            if (read(_glfw.linux_js.js[i].fd, &e, sizeof(e)) < 0)
-            {
-                if (errno == ENODEV)
-                {
-                    // The joystick was disconnected
-
-                    free(_glfw.linux_js.js[i].axes);
-                    free(_glfw.linux_js.js[i].buttons);
-                    free(_glfw.linux_js.js[i].name);
-                    free(_glfw.linux_js.js[i].path);
-
-                    memset(&_glfw.linux_js.js[i], 0, sizeof(_glfw.linux_js.js[i]));
-                }
-
-                break;
-            }
-
-            // We don't care if it's an init event or not
-            e.type &= ~JS_EVENT_INIT;
-
-            switch (e.type)
-            {
-                case JS_EVENT_AXIS:
-                    _glfw.linux_js.js[i].axes[e.number] =
-                        (float) e.value / 32767.0f;
-                    break;
-
-                case JS_EVENT_BUTTON:
-                    _glfw.linux_js.js[i].buttons[e.number] =
-                        e.value ? GLFW_PRESS : GLFW_RELEASE;
-                    break;
-
-                default:
-                    break;
-            }
+            // The joystick was disconnected
+            if (errno == ENODEV)
+                closeJoystickDevice(joy);
+
+            break;
         }
+
+        count = size / (ssize_t) sizeof(events[0]);
+
+        for (i = 0;  i < count;  i++)
+            handleEvent(joy, events + i);
+
+        if (count < _GLFW_EVENT_BUFFER_SIZE)
+            break;
     }
-#endif // __linux__
 }
 
+#endif // __linux__
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -202,6 +499,34 @@ int _glfwInitJoysticks(void)
         return GL_FALSE;
     }
 
+    _glfw.linux_js.epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (_glfw.linux_js.epoll == -1)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Linux: Failed to create joystick epoll set: %s",
+                        strerror(errno));
+
+        close(_glfw.linux_js.inotify);
+        _glfw.linux_js.inotify = -1;
+        return GL_FALSE;
+    }
+
+    {
+        struct epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.u32 = _GLFW_INOTIFY_TAG;
+
+        if (epoll_ctl(_glfw.linux_js.epoll, EPOLL_CTL_ADD,
+                      _glfw.linux_js.inotify, &event) == -1)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Linux: Failed to add inotify to joystick epoll set: %s",
+                            strerror(errno));
+            // Continue without device connection notifications
+        }
+    }
+
     // HACK: Register for IN_ATTRIB as well to get notified when udev is done
     //       This works well in practice but the true way is libudev
 
@@ -217,7 +542,7 @@ int _glfwInitJoysticks(void)
         // Continue without device connection notifications
     }
 
-    if (regcomp(&_glfw.linux_js.regex, "^js[0-9]\\+$", 0) != 0)
+    if (regcomp(&_glfw.linux_js.regex, "^event[0-9]\\+$", 0) != 0)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR, "Linux: Failed to compile regex");
         return GL_FALSE;
@@ -230,7 +555,7 @@ int _glfwInitJoysticks(void)
 
         while ((entry = readdir(dir)))
         {
-            char path[20];
+            char path[PATH_MAX];
             regmatch_t match;
 
             if (regexec(&_glfw.linux_js.regex, entry->d_name, 1, &match, 0) != 0)
@@ -266,13 +591,7 @@ void _glfwTerminateJoysticks(void)
     for (i = 0;  i <= GLFW_JOYSTICK_LAST;  i++)
     {
         if (_glfw.linux_js.js[i].present)
-        {
-            close(_glfw.linux_js.js[i].fd);
-            free(_glfw.linux_js.js[i].axes);
-            free(_glfw.linux_js.js[i].buttons);
-            free(_glfw.linux_js.js[i].name);
-            free(_glfw.linux_js.js[i].path);
-        }
+            closeJoystickDevice(i);
     }
 
     regfree(&_glfw.linux_js.regex);
@@ -284,6 +603,37 @@ void _glfwTerminateJoysticks(void)
 
         close(_glfw.linux_js.inotify);
     }
+
+    if (_glfw.linux_js.epoll > 0)
+        close(_glfw.linux_js.epoll);
+#endif // __linux__
+}
+
+// Drains the joystick epoll set and updates the state of all joysticks
+// This is called once per event processing pass by the window system backend
+//
+void _glfwPollJoystickEvents(void)
+{
+#if defined(__linux__)
+    int i, count;
+    struct epoll_event events[GLFW_JOYSTICK_LAST + 2];
+
+    if (_glfw.linux_js.epoll <= 0)
+        return;
+
+    count = epoll_wait(_glfw.linux_js.epoll,
+                       events, sizeof(events) / sizeof(events[0]),
+                       0);
+
+    for (i = 0;  i < count;  i++)
+    {
+        const int tag = (int) events[i].data.u32;
+
+        if (tag == _GLFW_INOTIFY_TAG)
+            handleDeviceNotifications();
+        else if (_glfw.linux_js.js[tag].present)
+            handleJoystickEvents(tag);
+    }
 #endif // __linux__
 }
 
@@ -294,31 +644,60 @@ void _glfwTerminateJoysticks(void)
 
 int _glfwPlatformJoystickPresent(int joy)
 {
-    pollJoystickEvents();
-
     return _glfw.linux_js.js[joy].present;
 }
 
 const float* _glfwPlatformGetJoystickAxes(int joy, int* count)
 {
-    pollJoystickEvents();
-
     *count = _glfw.linux_js.js[joy].axisCount;
     return _glfw.linux_js.js[joy].axes;
 }
 
 const unsigned char* _glfwPlatformGetJoystickButtons(int joy, int* count)
 {
-    pollJoystickEvents();
-
     *count = _glfw.linux_js.js[joy].buttonCount;
     return _glfw.linux_js.js[joy].buttons;
 }
 
 const char* _glfwPlatformGetJoystickName(int joy)
 {
-    pollJoystickEvents();
-
     return _glfw.linux_js.js[joy].name;
 }
 
+double _glfwPlatformGetJoystickTimestamp(int joy)
+{
+    return _glfw.linux_js.js[joy].timestamp;
+}
+
+int _glfwPlatformGetJoystickEvents(int joy, GLFWjoystickevent* events, int count)
+{
+#if defined(__linux__)
+    int available, first;
+    const unsigned int tail = _glfw.linux_js.js[joy].eventTail;
+    const GLFWjoystickevent* ring = _glfw.linux_js.js[joy].events;
+
+    if (!ring)
+        return 0;
+
+    available = (int) (_glfw.linux_js.js[joy].eventHead - tail);
+    if (count > available)
+        count = available;
+    if (count == 0)
+        return 0;
+
+    // Copy out the (at most two) contiguous runs of the ring buffer
+    first = _GLFW_JOYSTICK_EVENT_COUNT - (int) (tail & (_GLFW_JOYSTICK_EVENT_COUNT - 1));
+    if (first > count)
+        first = count;
+
+    memcpy(events, ring + (tail & (_GLFW_JOYSTICK_EVENT_COUNT - 1)),
+           first * sizeof(GLFWjoystickevent));
+    memcpy(events + first, ring, (count - first) * sizeof(GLFWjoystickevent));
+
+    _glfw.linux_js.js[joy].eventTail = tail + count;
+    return count;
+#else
+    return 0;
+#endif // __linux__
+}
+
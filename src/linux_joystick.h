@@ -29,6 +29,10 @@
 
 #include <regex.h>
 
+#if defined(__linux__)
+ #include <linux/input.h>
+#endif
+
 #define _GLFW_PLATFORM_LIBRARY_JOYSTICK_STATE \
     _GLFWjoystickLinux linux_js
 
@@ -47,11 +51,31 @@ typedef struct _GLFWjoystickLinux
         int             buttonCount;
         char*           name;
         char*           path;
+        // Time of the most recent input sample, on the GLFW timer
+        double          timestamp;
+        // Ring buffer of axis and button changes not yet retrieved
+        GLFWjoystickevent* events;
+        unsigned int    eventHead;
+        unsigned int    eventTail;
+
+#if defined(__linux__)
+        // Whether event timestamps are on the clock used by the GLFW timer
+        GLboolean       kernelTime;
+        // Whether events are being discarded after a SYN_DROPPED
+        GLboolean       dropped;
+        // evdev key and absolute axis codes to button and axis indices
+        int             keyMap[KEY_CNT - BTN_MISC];
+        int             absMap[ABS_CNT];
+        // Linear mapping of absolute axis ranges to [-1,1]
+        float           absScale[ABS_CNT];
+        float           absBias[ABS_CNT];
+#endif /*__linux__*/
     } js[GLFW_JOYSTICK_LAST + 1];
 
 #if defined(__linux__)
     int             inotify;
     int             watch;
+    int             epoll;
     regex_t         regex;
 #endif /*__linux__*/
 } _GLFWjoystickLinux;
@@ -59,5 +83,6 @@ typedef struct _GLFWjoystickLinux
 
 int _glfwInitJoysticks(void);
 void _glfwTerminateJoysticks(void);
+void _glfwPollJoystickEvents(void);
 
 #endif // _glfw3_linux_joystick_h_
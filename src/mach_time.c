@@ -69,3 +69,11 @@ void _glfwPlatformSetTime(double time)
         (uint64_t) (time / _glfw.ns_time.resolution);
 }
 
+void _glfwPlatformSleepUntil(double time)
+{
+    if (time <= _glfwPlatformGetTime())
+        return;
+
+    mach_wait_until((uint64_t) (_glfw.ns_time.base +
+                                time / _glfw.ns_time.resolution));
+}
@@ -93,6 +93,7 @@ typedef struct _GLFWlibraryMir
 
     pthread_mutex_t event_mutex;
     pthread_cond_t  event_cond;
+    GLboolean       wakeup;
 
 } _GLFWlibraryMir;
 
@@ -27,8 +27,10 @@
 #include "internal.h"
 
 #include <linux/input.h>
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 
 typedef struct EventNode
@@ -357,15 +359,19 @@ static void handleMotionEvent(const MirMotionEvent motion, _GLFWwindow* window)
 
 static void handleInput(MirEvent const* event, _GLFWwindow* window)
 {
+    // Mir event times are in nanoseconds on the monotonic clock
     switch (event->type)
     {
         case mir_event_type_key:
+            _glfwInputEventTime(_glfwConvertMonotonicTimestamp(event->key.event_time / 1000));
             handleKeyEvent(event->key, window);
             break;
         case mir_event_type_motion:
+            _glfwInputEventTime(_glfwConvertMonotonicTimestamp(event->motion.event_time / 1000));
             handleMotionEvent(event->motion, window);
             break;
         default:
+            _glfwInputEventTime(0.0);
             break;
     }
 }
@@ -459,6 +465,10 @@ int _glfwPlatformCreateWindow(_GLFWwindow* window,
     if (!_glfwCreateContext(window, ctxconfig, fbconfig))
         return GL_FALSE;
 
+    // Offscreen windows have no Mir surface
+    if (wndconfig->offscreen)
+        return GL_TRUE;
+
     if (wndconfig->monitor)
     {
         GLFWvidmode mode;
@@ -489,7 +499,7 @@ int _glfwPlatformCreateWindow(_GLFWwindow* window,
 
 void _glfwPlatformDestroyWindow(_GLFWwindow* window)
 {
-    if (mir_surface_is_valid(window->mir.surface))
+    if (window->mir.surface && mir_surface_is_valid(window->mir.surface))
     {
         mir_surface_release_sync(window->mir.surface);
         window->mir.surface = NULL;
@@ -596,21 +606,76 @@ void _glfwPlatformPollEvents(void)
         handleInput(node->event, node->window);
         deleteNode(_glfw.mir.event_queue, node);
     }
+
+    _glfwPollJoystickEvents();
 }
 
 void _glfwPlatformWaitEvents(void)
 {
     pthread_mutex_lock(&_glfw.mir.event_mutex);
 
-    if (emptyEventQueue(_glfw.mir.event_queue))
+    while (emptyEventQueue(_glfw.mir.event_queue) && !_glfw.mir.wakeup)
         pthread_cond_wait(&_glfw.mir.event_cond, &_glfw.mir.event_mutex);
 
+    _glfw.mir.wakeup = GL_FALSE;
+    pthread_mutex_unlock(&_glfw.mir.event_mutex);
+
+    _glfwPlatformPollEvents();
+}
+
+void _glfwPlatformWaitEventsTimeout(double timeout)
+{
+    struct timespec deadline;
+
+    // The condition variable uses the default realtime clock
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t) timeout;
+    deadline.tv_nsec += (long) ((timeout - (time_t) timeout) * 1e9);
+    if (deadline.tv_nsec >= 1000000000)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+
+    pthread_mutex_lock(&_glfw.mir.event_mutex);
+
+    while (emptyEventQueue(_glfw.mir.event_queue) && !_glfw.mir.wakeup)
+    {
+        if (pthread_cond_timedwait(&_glfw.mir.event_cond,
+                                   &_glfw.mir.event_mutex,
+                                   &deadline) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+
+    _glfw.mir.wakeup = GL_FALSE;
     pthread_mutex_unlock(&_glfw.mir.event_mutex);
 
     _glfwPlatformPollEvents();
 }
 
 void _glfwPlatformPostEmptyEvent(void)
+{
+    // The flag makes the wakeup stick even if no thread is waiting yet
+    pthread_mutex_lock(&_glfw.mir.event_mutex);
+    _glfw.mir.wakeup = GL_TRUE;
+    pthread_cond_signal(&_glfw.mir.event_cond);
+    pthread_mutex_unlock(&_glfw.mir.event_mutex);
+}
+
+int _glfwPlatformWatchFileDescriptor(int fd, int events)
+{
+    _glfwInputError(GLFW_API_UNAVAILABLE,
+                    "Mir: Watching file descriptors is not supported");
+    return GL_FALSE;
+}
+
+void _glfwPlatformUnwatchFileDescriptor(int fd)
+{
+}
+
+void _glfwPlatformSetJoystickWakeup(int enabled)
 {
 }
 
@@ -676,6 +741,18 @@ void _glfwPlatformSetClipboardString(_GLFWwindow* window, const char* string)
                     "Mir: Unsupported function %s", __PRETTY_FUNCTION__);
 }
 
+void _glfwPlatformSetClipboardData(_GLFWwindow* window,
+                                   const char** types, int count,
+                                   void* data, size_t size,
+                                   GLFWclipboardfreefun cbfun)
+{
+    _glfwInputError(GLFW_PLATFORM_ERROR,
+                    "Mir: Unsupported function %s", __PRETTY_FUNCTION__);
+
+    if (cbfun)
+        cbfun(data);
+}
+
 const char* _glfwPlatformGetClipboardString(_GLFWwindow* window)
 {
     _glfwInputError(GLFW_PLATFORM_ERROR,
@@ -684,3 +761,8 @@ const char* _glfwPlatformGetClipboardString(_GLFWwindow* window)
     return NULL;
 }
 
+void _glfwPlatformRequestClipboardString(_GLFWwindow* window)
+{
+    _glfwInputClipboardString(window, _glfwPlatformGetClipboardString(window));
+}
+
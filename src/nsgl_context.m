@@ -274,6 +274,12 @@ void _glfwPlatformSwapInterval(int interval)
     [window->nsgl.context setValues:&sync forParameter:NSOpenGLCPSwapInterval];
 }
 
+int _glfwPlatformGetFrameTiming(_GLFWwindow* window)
+{
+    // NSGL has no way to query when a swap was presented
+    return GL_FALSE;
+}
+
 int _glfwPlatformExtensionSupported(const char* extension)
 {
     // There are no NSGL extensions
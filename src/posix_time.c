@@ -29,6 +29,10 @@
 
 #include <sys/time.h>
 #include <time.h>
+#include <errno.h>
+
+// The age, in milliseconds, beyond which an event timestamp is not trusted
+#define _GLFW_MAX_EVENT_AGE 10000
 
 // Return raw time
 //
@@ -78,6 +82,63 @@ void _glfwInitTimer(void)
     _glfw.posix_time.base = getRawTime();
 }
 
+// Converts a timestamp from the clock source of the timer to GLFW time
+//
+double _glfwConvertTimestamp(uint64_t sec, uint64_t nsec)
+{
+    uint64_t value;
+
+#if defined(CLOCK_MONOTONIC)
+    if (_glfw.posix_time.monotonic)
+        value = sec * (uint64_t) 1000000000 + nsec;
+    else
+#endif
+        value = sec * (uint64_t) 1000000 + nsec / (uint64_t) 1000;
+
+    return (double) (int64_t) (value - _glfw.posix_time.base) *
+        _glfw.posix_time.resolution;
+}
+
+// Converts a timestamp in microseconds on the monotonic clock to GLFW time,
+// or returns zero if the timer does not use that clock
+//
+double _glfwConvertMonotonicTimestamp(uint64_t usec)
+{
+#if defined(CLOCK_MONOTONIC)
+    if (_glfw.posix_time.monotonic)
+    {
+        return _glfwConvertTimestamp(usec / (uint64_t) 1000000,
+                                     usec % (uint64_t) 1000000 * 1000);
+    }
+#endif
+
+    return 0.0;
+}
+
+// Converts a wrapping 32-bit millisecond timestamp on the monotonic clock, as
+// used for X11 and Wayland events, to GLFW time, or returns zero if the
+// timestamp does not appear to be on that clock
+//
+double _glfwConvertMillisecondTimestamp(uint32_t msec)
+{
+#if defined(CLOCK_MONOTONIC)
+    if (_glfw.posix_time.monotonic)
+    {
+        // The timestamp holds the low bits of the clock in milliseconds, which
+        // is enough to recover the rest for any recent event
+        const uint64_t now = getRawTime() / (uint64_t) 1000000;
+        const uint32_t age = (uint32_t) now - msec;
+
+        // Timestamps that are not from the last few seconds are most likely
+        // from some other clock
+        if (age < _GLFW_MAX_EVENT_AGE)
+            return _glfwConvertMonotonicTimestamp((now - age) * (uint64_t) 1000);
+    }
+#endif
+
+    return 0.0;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -95,3 +156,40 @@ void _glfwPlatformSetTime(double time)
         (uint64_t) (time / _glfw.posix_time.resolution);
 }
 
+void _glfwPlatformSleepUntil(double time)
+{
+    struct timespec ts;
+
+    if (time <= _glfwPlatformGetTime())
+        return;
+
+#if defined(CLOCK_MONOTONIC)
+    if (_glfw.posix_time.monotonic)
+    {
+        // An absolute sleep is not lengthened by being interrupted or by the
+        // time spent setting it up
+        const uint64_t target = _glfw.posix_time.base +
+            (uint64_t) (time / _glfw.posix_time.resolution);
+
+        ts.tv_sec = (time_t) (target / (uint64_t) 1000000000);
+        ts.tv_nsec = (long) (target % (uint64_t) 1000000000);
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+            ;
+
+        return;
+    }
+#endif
+
+    for (;;)
+    {
+        const double remaining = time - _glfwPlatformGetTime();
+        if (remaining <= 0.0)
+            break;
+
+        ts.tv_sec = (time_t) remaining;
+        ts.tv_nsec = (long) ((remaining - ts.tv_sec) * 1e9);
+
+        nanosleep(&ts, NULL);
+    }
+}
@@ -45,5 +45,8 @@ typedef struct _GLFWtimePOSIX
 
 
 void _glfwInitTimer(void);
+double _glfwConvertTimestamp(uint64_t sec, uint64_t nsec);
+double _glfwConvertMonotonicTimestamp(uint64_t usec);
+double _glfwConvertMillisecondTimestamp(uint32_t msec);
 
 #endif // _glfw3_posix_time_h_
@@ -27,6 +27,22 @@
 
 #include "internal.h"
 
+#include <string.h>
+
+
+#if defined(_GLFW_THREAD_LOCAL)
+
+// The state of each thread, read directly by every current context query
+//
+static _GLFW_THREAD_LOCAL _GLFWthreadPOSIX _glfwThreadState;
+
+// The generation of the most recently initialized library instance
+// This outlives the library state, which is cleared on termination
+//
+static unsigned int _glfwGeneration = 0;
+
+#endif // _GLFW_THREAD_LOCAL
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -34,24 +50,100 @@
 
 int _glfwCreateContextTLS(void)
 {
+#if defined(_GLFW_THREAD_LOCAL)
+    // Contexts made current by an earlier library instance are no longer
+    // valid on any thread
+    _glfw.posix_tls.generation = ++_glfwGeneration;
+#else
     if (pthread_key_create(&_glfw.posix_tls.context, NULL) != 0)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "POSIX: Failed to create context TLS");
         return GL_FALSE;
     }
+#endif
 
     return GL_TRUE;
 }
 
 void _glfwDestroyContextTLS(void)
 {
+#if defined(_GLFW_THREAD_LOCAL)
+    _glfwThreadState.context = NULL;
+#else
     pthread_key_delete(_glfw.posix_tls.context);
+#endif
 }
 
 void _glfwSetContextTLS(_GLFWwindow* context)
 {
+#if defined(_GLFW_THREAD_LOCAL)
+    _glfwThreadState.context = context;
+    _glfwThreadState.generation = _glfw.posix_tls.generation;
+#else
     pthread_setspecific(_glfw.posix_tls.context, context);
+#endif
+}
+
+int _glfwCreateMutex(_GLFWmutex* mutex)
+{
+    if (pthread_mutex_init(&mutex->posix_tls.handle, NULL) != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR, "POSIX: Failed to create mutex");
+        return GL_FALSE;
+    }
+
+    mutex->posix_tls.allocated = GL_TRUE;
+    return GL_TRUE;
+}
+
+void _glfwDestroyMutex(_GLFWmutex* mutex)
+{
+    if (mutex->posix_tls.allocated)
+        pthread_mutex_destroy(&mutex->posix_tls.handle);
+
+    memset(mutex, 0, sizeof(_GLFWmutex));
+}
+
+void _glfwLockMutex(_GLFWmutex* mutex)
+{
+    pthread_mutex_lock(&mutex->posix_tls.handle);
+}
+
+void _glfwUnlockMutex(_GLFWmutex* mutex)
+{
+    pthread_mutex_unlock(&mutex->posix_tls.handle);
+}
+
+// Loads the value with acquire ordering
+//
+unsigned int _glfwAtomicLoad(volatile unsigned int* target)
+{
+    return __atomic_load_n(target, __ATOMIC_ACQUIRE);
+}
+
+// Stores the value with release ordering
+//
+void _glfwAtomicStore(volatile unsigned int* target, unsigned int value)
+{
+    __atomic_store_n(target, value, __ATOMIC_RELEASE);
+}
+
+// Replaces the value and returns the previous one
+//
+unsigned int _glfwAtomicExchange(volatile unsigned int* target, unsigned int value)
+{
+    return __atomic_exchange_n(target, value, __ATOMIC_ACQ_REL);
+}
+
+// Replaces the value if it is the expected one and returns whether it was
+//
+int _glfwAtomicCompareExchange(volatile unsigned int* target,
+                               unsigned int expected,
+                               unsigned int desired)
+{
+    return __atomic_compare_exchange_n(target, &expected, desired, 0,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
 }
 
 
@@ -61,6 +153,13 @@ void _glfwSetContextTLS(_GLFWwindow* context)
 
 _GLFWwindow* _glfwPlatformGetCurrentContext(void)
 {
+#if defined(_GLFW_THREAD_LOCAL)
+    if (_glfwThreadState.generation != _glfw.posix_tls.generation)
+        return NULL;
+
+    return _glfwThreadState.context;
+#else
     return pthread_getspecific(_glfw.posix_tls.context);
+#endif
 }
 
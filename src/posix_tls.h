@@ -31,19 +31,70 @@
 #include <pthread.h>
 
 #define _GLFW_PLATFORM_LIBRARY_TLS_STATE _GLFWtlsPOSIX posix_tls
+#define _GLFW_PLATFORM_MUTEX_STATE       _GLFWmutexPOSIX posix_tls
+
+// Use compiler-provided thread-local storage where available, as it avoids
+// a call to pthread_getspecific for every current context query
+#if !defined(_GLFW_USE_PTHREAD_KEYS)
+ #if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+  #define _GLFW_THREAD_LOCAL _Thread_local
+ #elif defined(__GNUC__)
+  #define _GLFW_THREAD_LOCAL __thread
+ #endif
+#endif
 
 
 // POSIX-specific global TLS data
 //
 typedef struct _GLFWtlsPOSIX
 {
+#if defined(_GLFW_THREAD_LOCAL)
+    // Generation of the current library instance, used to discard per-thread
+    // state left over from before the library was last terminated
+    unsigned int    generation;
+#else
     pthread_key_t   context;
+#endif
 
 } _GLFWtlsPOSIX;
 
 
+#if defined(_GLFW_THREAD_LOCAL)
+// POSIX-specific per-thread data
+//
+typedef struct _GLFWthreadPOSIX
+{
+    _GLFWwindow*    context;
+    unsigned int    generation;
+
+} _GLFWthreadPOSIX;
+#endif
+
+
+// POSIX-specific mutex data
+//
+typedef struct _GLFWmutexPOSIX
+{
+    GLboolean       allocated;
+    pthread_mutex_t handle;
+
+} _GLFWmutexPOSIX;
+
+
 int _glfwCreateContextTLS(void);
 void _glfwDestroyContextTLS(void);
 void _glfwSetContextTLS(_GLFWwindow* context);
 
+int _glfwCreateMutex(_GLFWmutex* mutex);
+void _glfwDestroyMutex(_GLFWmutex* mutex);
+void _glfwLockMutex(_GLFWmutex* mutex);
+void _glfwUnlockMutex(_GLFWmutex* mutex);
+
+unsigned int _glfwAtomicLoad(volatile unsigned int* target);
+void _glfwAtomicStore(volatile unsigned int* target, unsigned int value);
+unsigned int _glfwAtomicExchange(volatile unsigned int* target, unsigned int value);
+int _glfwAtomicCompareExchange(volatile unsigned int* target,
+                               unsigned int expected,
+                               unsigned int desired);
+
 #endif // _glfw3_posix_tls_h_
@@ -0,0 +1,470 @@
+//========================================================================
+// GLFW 3.1 POSIX - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2002-2006 Marcus Geelnard
+// Copyright (c) 2006-2010 Camilla Berglund <elmindreda@elmindreda.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+
+#include "internal.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+ #include <sys/epoll.h>
+ #include <sys/eventfd.h>
+#else
+ #include <poll.h>
+#endif
+
+// The number of ready descriptors retrieved per wait
+#define _GLFW_WAIT_EVENT_COUNT 16
+
+
+// Converts a relative timeout in seconds to milliseconds for poll and epoll,
+// rounding up so that a short wait does not turn into a poll
+//
+static int getTimeoutMS(double timeout)
+{
+    if (timeout < 0.0)
+        return -1;
+
+    if (timeout * 1e3 >= INT_MAX)
+        return INT_MAX;
+
+    return (int) ceil(timeout * 1e3);
+}
+
+#if defined(__linux__)
+
+// Translates GLFW descriptor events to epoll events
+//
+static uint32_t translateToEpoll(int events)
+{
+    uint32_t result = 0;
+
+    if (events & GLFW_FD_READABLE)
+        result |= EPOLLIN;
+    if (events & GLFW_FD_WRITABLE)
+        result |= EPOLLOUT;
+
+    return result;
+}
+
+// Translates epoll events to GLFW descriptor events
+//
+static int translateFromEpoll(uint32_t events)
+{
+    int result = 0;
+
+    if (events & EPOLLIN)
+        result |= GLFW_FD_READABLE;
+    if (events & EPOLLOUT)
+        result |= GLFW_FD_WRITABLE;
+    if (events & (EPOLLERR | EPOLLHUP))
+        result |= GLFW_FD_ERROR;
+
+    return result;
+}
+
+// Adds a descriptor to the epoll set or updates its events if already present
+//
+static GLboolean addToEpoll(int fd, uint32_t events)
+{
+    struct epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = events;
+    event.data.fd = fd;
+
+    if (epoll_ctl(_glfw.posix_wait.epoll, EPOLL_CTL_ADD, fd, &event) == 0)
+        return GL_TRUE;
+
+    if (errno == EEXIST &&
+        epoll_ctl(_glfw.posix_wait.epoll, EPOLL_CTL_MOD, fd, &event) == 0)
+    {
+        return GL_TRUE;
+    }
+
+    return GL_FALSE;
+}
+
+#else
+
+// Translates GLFW descriptor events to poll events
+//
+static short translateToPoll(int events)
+{
+    short result = 0;
+
+    if (events & GLFW_FD_READABLE)
+        result |= POLLIN;
+    if (events & GLFW_FD_WRITABLE)
+        result |= POLLOUT;
+
+    return result;
+}
+
+// Translates poll events to GLFW descriptor events
+//
+static int translateFromPoll(short events)
+{
+    int result = 0;
+
+    if (events & POLLIN)
+        result |= GLFW_FD_READABLE;
+    if (events & POLLOUT)
+        result |= GLFW_FD_WRITABLE;
+    if (events & (POLLERR | POLLHUP | POLLNVAL))
+        result |= GLFW_FD_ERROR;
+
+    return result;
+}
+
+#endif /*__linux__*/
+
+// Creates the wakeup signal descriptors
+//
+static GLboolean createSignal(void)
+{
+#if defined(__linux__)
+    const int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd == -1)
+        return GL_FALSE;
+
+    _glfw.posix_wait.signal[0] = fd;
+    _glfw.posix_wait.signal[1] = fd;
+#else
+    int i;
+
+    if (pipe(_glfw.posix_wait.signal) != 0)
+        return GL_FALSE;
+
+    for (i = 0;  i < 2;  i++)
+    {
+        const int fd = _glfw.posix_wait.signal[i];
+
+        if (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == -1 ||
+            fcntl(fd, F_SETFD, fcntl(fd, F_GETFD) | FD_CLOEXEC) == -1)
+        {
+            return GL_FALSE;
+        }
+    }
+#endif /*__linux__*/
+
+    return GL_TRUE;
+}
+
+// Clears a pending wakeup signal
+//
+static void drainSignal(void)
+{
+    ssize_t result;
+#if defined(__linux__)
+    uint64_t value;
+
+    do
+        result = read(_glfw.posix_wait.signal[0], &value, sizeof(value));
+    while (result == -1 && errno == EINTR);
+#else
+    char buffer[64];
+
+    do
+        result = read(_glfw.posix_wait.signal[0], buffer, sizeof(buffer));
+    while (result > 0 || (result == -1 && errno == EINTR));
+#endif /*__linux__*/
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Initialize the event wait for the specified window system connection
+//
+int _glfwInitWait(int display)
+{
+    _glfw.posix_wait.display = display;
+
+    if (!createSignal())
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to create event wait signal: %s",
+                        strerror(errno));
+        return GL_FALSE;
+    }
+
+#if defined(__linux__)
+    _glfw.posix_wait.epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (_glfw.posix_wait.epoll == -1)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to create event wait epoll set: %s",
+                        strerror(errno));
+        return GL_FALSE;
+    }
+
+    if (!addToEpoll(display, EPOLLIN))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to add display connection to epoll set: %s",
+                        strerror(errno));
+        return GL_FALSE;
+    }
+
+    if (!addToEpoll(_glfw.posix_wait.signal[0], EPOLLIN))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to add event wait signal to epoll set: %s",
+                        strerror(errno));
+        return GL_FALSE;
+    }
+#endif /*__linux__*/
+
+    return GL_TRUE;
+}
+
+// Terminate the event wait
+//
+void _glfwTerminateWait(void)
+{
+#if defined(__linux__)
+    if (_glfw.posix_wait.epoll > 0)
+        close(_glfw.posix_wait.epoll);
+#endif /*__linux__*/
+
+    if (_glfw.posix_wait.signal[0] > 0)
+        close(_glfw.posix_wait.signal[0]);
+    if (_glfw.posix_wait.signal[1] > 0 &&
+        _glfw.posix_wait.signal[1] != _glfw.posix_wait.signal[0])
+    {
+        close(_glfw.posix_wait.signal[1]);
+    }
+}
+
+// Waits until the window system connection or a watched descriptor is ready,
+// the wait is signaled or the timeout in seconds has passed
+// A negative timeout waits indefinitely
+// Returns whether the window system connection is readable
+//
+GLboolean _glfwWaitForEvents(double timeout)
+{
+    int i, count;
+    GLboolean display = GL_FALSE;
+
+#if defined(__linux__)
+    struct epoll_event events[_GLFW_WAIT_EVENT_COUNT];
+
+    count = epoll_wait(_glfw.posix_wait.epoll,
+                       events, _GLFW_WAIT_EVENT_COUNT,
+                       getTimeoutMS(timeout));
+
+    for (i = 0;  i < count;  i++)
+    {
+        if (events[i].data.fd == _glfw.posix_wait.display)
+            display = GL_TRUE;
+        else if (events[i].data.fd == _glfw.posix_wait.signal[0])
+            drainSignal();
+    }
+#else
+    struct pollfd* fds = calloc(_glfw.watchCount + 2, sizeof(struct pollfd));
+
+    fds[0].fd = _glfw.posix_wait.display;
+    fds[0].events = POLLIN;
+    fds[1].fd = _glfw.posix_wait.signal[0];
+    fds[1].events = POLLIN;
+
+    for (i = 0;  i < _glfw.watchCount;  i++)
+    {
+        fds[i + 2].fd = _glfw.watches[i].fd;
+        fds[i + 2].events = translateToPoll(_glfw.watches[i].events);
+    }
+
+    count = poll(fds, _glfw.watchCount + 2, getTimeoutMS(timeout));
+    if (count > 0)
+    {
+        if (fds[0].revents & POLLIN)
+            display = GL_TRUE;
+        if (fds[1].revents & POLLIN)
+            drainSignal();
+    }
+
+    free(fds);
+#endif /*__linux__*/
+
+    return display;
+}
+
+// Ends any current or next wait of the main thread
+// This may be called from any thread
+//
+void _glfwSignalWait(void)
+{
+    ssize_t result;
+#if defined(__linux__)
+    const uint64_t value = 1;
+#else
+    const char value = 0;
+#endif /*__linux__*/
+
+    do
+        result = write(_glfw.posix_wait.signal[1], &value, sizeof(value));
+    while (result == -1 && errno == EINTR);
+
+    // A full pipe or saturated counter means a wakeup is already pending
+    if (result == -1 && errno != EAGAIN && errno != EWOULDBLOCK)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to signal event wait: %s",
+                        strerror(errno));
+    }
+}
+
+// Calls the callbacks of every watched descriptor that is ready
+// This is called once per event processing pass by the window system backend
+//
+void _glfwPollWatchedEvents(void)
+{
+    int i, count;
+
+    if (!_glfw.watchCount)
+        return;
+
+#if defined(__linux__)
+    {
+        struct epoll_event events[_GLFW_WAIT_EVENT_COUNT];
+
+        count = epoll_wait(_glfw.posix_wait.epoll,
+                           events, _GLFW_WAIT_EVENT_COUNT,
+                           0);
+
+        // Callbacks may change the watches, so each event is looked up again
+        // by its descriptor
+        for (i = 0;  i < count;  i++)
+        {
+            const int fd = events[i].data.fd;
+
+            if (fd == _glfw.posix_wait.display ||
+                fd == _glfw.posix_wait.signal[0])
+            {
+                continue;
+            }
+
+            if (_glfw.posix_wait.joystickWakeup && fd == _glfw.linux_js.epoll)
+                continue;
+
+            _glfwInputFileDescriptor(fd, translateFromEpoll(events[i].events));
+        }
+    }
+#else
+    {
+        struct pollfd* fds = calloc(_glfw.watchCount, sizeof(struct pollfd));
+
+        count = _glfw.watchCount;
+
+        for (i = 0;  i < count;  i++)
+        {
+            fds[i].fd = _glfw.watches[i].fd;
+            fds[i].events = translateToPoll(_glfw.watches[i].events);
+        }
+
+        // Callbacks may change the watches, so events are dispatched from the
+        // copy and looked up again by their descriptor
+        if (poll(fds, count, 0) > 0)
+        {
+            for (i = 0;  i < count;  i++)
+            {
+                if (fds[i].revents)
+                {
+                    _glfwInputFileDescriptor(fds[i].fd,
+                                             translateFromPoll(fds[i].revents));
+                }
+            }
+        }
+
+        free(fds);
+    }
+#endif /*__linux__*/
+}
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW platform API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+int _glfwPlatformWatchFileDescriptor(int fd, int events)
+{
+#if defined(__linux__)
+    if (!addToEpoll(fd, translateToEpoll(events)))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to watch file descriptor %i: %s",
+                        fd, strerror(errno));
+        return GL_FALSE;
+    }
+#endif /*__linux__*/
+
+    return GL_TRUE;
+}
+
+void _glfwPlatformUnwatchFileDescriptor(int fd)
+{
+#if defined(__linux__)
+    struct epoll_event event;
+
+    // This fails harmlessly if the descriptor has already been closed, which
+    // removes it from the set
+    epoll_ctl(_glfw.posix_wait.epoll, EPOLL_CTL_DEL, fd, &event);
+#endif /*__linux__*/
+}
+
+void _glfwPlatformSetJoystickWakeup(int enabled)
+{
+#if defined(__linux__)
+    if (_glfw.linux_js.epoll <= 0 || _glfw.posix_wait.joystickWakeup == enabled)
+        return;
+
+    if (enabled)
+    {
+        if (!addToEpoll(_glfw.linux_js.epoll, EPOLLIN))
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Linux: Failed to add joysticks to epoll set: %s",
+                            strerror(errno));
+            return;
+        }
+    }
+    else
+    {
+        struct epoll_event event;
+        epoll_ctl(_glfw.posix_wait.epoll, EPOLL_CTL_DEL,
+                  _glfw.linux_js.epoll, &event);
+    }
+
+    _glfw.posix_wait.joystickWakeup = enabled;
+#endif /*__linux__*/
+}
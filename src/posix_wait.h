@@ -0,0 +1,60 @@
+//========================================================================
+// GLFW 3.1 POSIX - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2002-2006 Marcus Geelnard
+// Copyright (c) 2006-2010 Camilla Berglund <elmindreda@elmindreda.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+
+#ifndef _glfw3_posix_wait_h_
+#define _glfw3_posix_wait_h_
+
+#define _GLFW_PLATFORM_LIBRARY_WAIT_STATE _GLFWwaitPOSIX posix_wait
+
+
+// POSIX-specific event wait data
+//
+typedef struct _GLFWwaitPOSIX
+{
+    // File descriptor of the window system connection
+    int             display;
+    // Read and write ends of the wakeup signal, which are the same eventfd
+    // on Linux and the two ends of a pipe elsewhere
+    int             signal[2];
+
+#if defined(__linux__)
+    // Set of the connection, watched descriptors and, if enabled, the joystick
+    // epoll set
+    int             epoll;
+    GLboolean       joystickWakeup;
+#endif /*__linux__*/
+} _GLFWwaitPOSIX;
+
+
+int _glfwInitWait(int display);
+void _glfwTerminateWait(void);
+GLboolean _glfwWaitForEvents(double timeout);
+void _glfwSignalWait(void);
+void _glfwPollWatchedEvents(void);
+
+#endif // _glfw3_posix_wait_h_
@@ -596,6 +596,12 @@ void _glfwPlatformSwapInterval(int interval)
         window->wgl.SwapIntervalEXT(interval);
 }
 
+int _glfwPlatformGetFrameTiming(_GLFWwindow* window)
+{
+    // WGL has no way to query when a swap was presented
+    return GL_FALSE;
+}
+
 int _glfwPlatformExtensionSupported(const char* extension)
 {
     const GLubyte* extensions;
@@ -84,3 +84,19 @@ void _glfwPlatformSetTime(double time)
         (unsigned __int64) (time / _glfw.win32_time.resolution);
 }
 
+void _glfwPlatformSleepUntil(double time)
+{
+    for (;;)
+    {
+        const double remaining = time - _glfwPlatformGetTime();
+        if (remaining <= 0.0)
+            break;
+
+        // Sleep only has millisecond granularity at best, so the last stretch
+        // is spent yielding the rest of each time slice instead
+        if (remaining > 0.002)
+            Sleep((DWORD) ((remaining - 0.002) * 1000.0));
+        else
+            Sleep(0);
+    }
+}
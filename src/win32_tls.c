@@ -27,6 +27,8 @@
 
 #include "internal.h"
 
+#include <string.h>
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -57,6 +59,64 @@ void _glfwSetContextTLS(_GLFWwindow* context)
     TlsSetValue(_glfw.win32_tls.context, context);
 }
 
+int _glfwCreateMutex(_GLFWmutex* mutex)
+{
+    InitializeCriticalSection(&mutex->win32_tls.section);
+    mutex->win32_tls.allocated = GL_TRUE;
+    return GL_TRUE;
+}
+
+void _glfwDestroyMutex(_GLFWmutex* mutex)
+{
+    if (mutex->win32_tls.allocated)
+        DeleteCriticalSection(&mutex->win32_tls.section);
+
+    memset(mutex, 0, sizeof(_GLFWmutex));
+}
+
+void _glfwLockMutex(_GLFWmutex* mutex)
+{
+    EnterCriticalSection(&mutex->win32_tls.section);
+}
+
+void _glfwUnlockMutex(_GLFWmutex* mutex)
+{
+    LeaveCriticalSection(&mutex->win32_tls.section);
+}
+
+// Loads the value with acquire ordering
+//
+unsigned int _glfwAtomicLoad(volatile unsigned int* target)
+{
+    // The interlocked functions are full barriers
+    return (unsigned int) InterlockedCompareExchange((volatile LONG*) target, 0, 0);
+}
+
+// Stores the value with release ordering
+//
+void _glfwAtomicStore(volatile unsigned int* target, unsigned int value)
+{
+    InterlockedExchange((volatile LONG*) target, (LONG) value);
+}
+
+// Replaces the value and returns the previous one
+//
+unsigned int _glfwAtomicExchange(volatile unsigned int* target, unsigned int value)
+{
+    return (unsigned int) InterlockedExchange((volatile LONG*) target, (LONG) value);
+}
+
+// Replaces the value if it is the expected one and returns whether it was
+//
+int _glfwAtomicCompareExchange(volatile unsigned int* target,
+                               unsigned int expected,
+                               unsigned int desired)
+{
+    return InterlockedCompareExchange((volatile LONG*) target,
+                                      (LONG) desired,
+                                      (LONG) expected) == (LONG) expected;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -29,6 +29,7 @@
 #define _glfw3_win32_tls_h_
 
 #define _GLFW_PLATFORM_LIBRARY_TLS_STATE _GLFWtlsWin32 win32_tls
+#define _GLFW_PLATFORM_MUTEX_STATE       _GLFWmutexWin32 win32_tls
 
 
 // Win32-specific global TLS data
@@ -41,8 +42,30 @@ typedef struct _GLFWtlsWin32
 } _GLFWtlsWin32;
 
 
+// Win32-specific mutex data
+//
+typedef struct _GLFWmutexWin32
+{
+    GLboolean        allocated;
+    CRITICAL_SECTION section;
+
+} _GLFWmutexWin32;
+
+
 int _glfwCreateContextTLS(void);
 void _glfwDestroyContextTLS(void);
 void _glfwSetContextTLS(_GLFWwindow* context);
 
+int _glfwCreateMutex(_GLFWmutex* mutex);
+void _glfwDestroyMutex(_GLFWmutex* mutex);
+void _glfwLockMutex(_GLFWmutex* mutex);
+void _glfwUnlockMutex(_GLFWmutex* mutex);
+
+unsigned int _glfwAtomicLoad(volatile unsigned int* target);
+void _glfwAtomicStore(volatile unsigned int* target, unsigned int value);
+unsigned int _glfwAtomicExchange(volatile unsigned int* target, unsigned int value);
+int _glfwAtomicCompareExchange(volatile unsigned int* target,
+                               unsigned int expected,
+                               unsigned int desired);
+
 #endif // _glfw3_win32_tls_h_
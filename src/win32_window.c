@@ -801,6 +801,13 @@ int _glfwPlatformCreateWindow(_GLFWwindow* window,
 {
     int status;
 
+    if (wndconfig->offscreen)
+    {
+        _glfwInputError(GLFW_API_UNAVAILABLE,
+                        "Win32: Offscreen windows are not supported");
+        return GL_FALSE;
+    }
+
     if (!createWindow(window, wndconfig, ctxconfig, fbconfig))
         return GL_FALSE;
 
@@ -1030,10 +1037,10 @@ void _glfwPlatformPollEvents(void)
 
             // See if this differs from our belief of what has happened
             // (we only have to check for lost key up events)
-            if (!lshiftDown && window->keys[GLFW_KEY_LEFT_SHIFT] == 1)
+            if (!lshiftDown && _GLFW_GET_BIT(window->keys.down, GLFW_KEY_LEFT_SHIFT))
                 _glfwInputKey(window, GLFW_KEY_LEFT_SHIFT, 0, GLFW_RELEASE, mods);
 
-            if (!rshiftDown && window->keys[GLFW_KEY_RIGHT_SHIFT] == 1)
+            if (!rshiftDown && _GLFW_GET_BIT(window->keys.down, GLFW_KEY_RIGHT_SHIFT))
                 _glfwInputKey(window, GLFW_KEY_RIGHT_SHIFT, 0, GLFW_RELEASE, mods);
         }
 
@@ -1054,10 +1061,33 @@ void _glfwPlatformWaitEvents(void)
     _glfwPlatformPollEvents();
 }
 
+void _glfwPlatformWaitEventsTimeout(double timeout)
+{
+    MsgWaitForMultipleObjects(0, NULL, FALSE, (DWORD) (timeout * 1e3), QS_ALLEVENTS);
+
+    _glfwPlatformPollEvents();
+}
+
 void _glfwPlatformPostEmptyEvent(void)
 {
     _GLFWwindow* window = _glfw.windowListHead;
-    PostMessage(window->win32.handle, WM_NULL, 0, 0);
+    if (window)
+        PostMessage(window->win32.handle, WM_NULL, 0, 0);
+}
+
+int _glfwPlatformWatchFileDescriptor(int fd, int events)
+{
+    _glfwInputError(GLFW_API_UNAVAILABLE,
+                    "Win32: Watching file descriptors is not supported");
+    return GL_FALSE;
+}
+
+void _glfwPlatformUnwatchFileDescriptor(int fd)
+{
+}
+
+void _glfwPlatformSetJoystickWakeup(int enabled)
+{
 }
 
 void _glfwPlatformGetCursorPos(_GLFWwindow* window, double* xpos, double* ypos)
@@ -1250,6 +1280,62 @@ void _glfwPlatformSetClipboardString(_GLFWwindow* window, const char* string)
     free(wideString);
 }
 
+void _glfwPlatformSetClipboardData(_GLFWwindow* window,
+                                   const char** types, int count,
+                                   void* data, size_t size,
+                                   GLFWclipboardfreefun cbfun)
+{
+    int i;
+
+    if (!OpenClipboard(window->win32.handle))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR, "Win32: Failed to open clipboard");
+
+        if (cbfun)
+            cbfun(data);
+
+        return;
+    }
+
+    EmptyClipboard();
+
+    // The clipboard takes ownership of each handle, so the data is copied
+    // once for every format it is offered as
+    for (i = 0;  i < count;  i++)
+    {
+        UINT format;
+        HANDLE dataHandle;
+        WCHAR* wideType = _glfwCreateWideStringFromUTF8(types[i]);
+        if (!wideType)
+            continue;
+
+        format = RegisterClipboardFormatW(wideType);
+        free(wideType);
+
+        if (!format)
+            continue;
+
+        dataHandle = GlobalAlloc(GMEM_MOVEABLE, size ? size : 1);
+        if (!dataHandle)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Win32: Failed to allocate global handle for clipboard");
+            break;
+        }
+
+        memcpy(GlobalLock(dataHandle), data, size);
+        GlobalUnlock(dataHandle);
+
+        if (!SetClipboardData(format, dataHandle))
+            GlobalFree(dataHandle);
+    }
+
+    CloseClipboard();
+
+    if (cbfun)
+        cbfun(data);
+}
+
 const char* _glfwPlatformGetClipboardString(_GLFWwindow* window)
 {
     HANDLE stringHandle;
@@ -1287,6 +1373,11 @@ const char* _glfwPlatformGetClipboardString(_GLFWwindow* window)
     return _glfw.win32.clipboardString;
 }
 
+void _glfwPlatformRequestClipboardString(_GLFWwindow* window)
+{
+    _glfwInputClipboardString(window, _glfwPlatformGetClipboardString(window));
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
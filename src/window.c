@@ -30,6 +30,78 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <float.h>
+
+
+// Waits for events for at most the specified non-negative number of seconds
+//
+static void waitEventsTimeout(double timeout)
+{
+    // Every platform waits with at most integer milliseconds, so longer
+    // timeouts are untimed waits instead of overflowing platform conversions
+    if (timeout * 1e3 > INT_MAX)
+        _glfwPlatformWaitEvents();
+    else
+        _glfwPlatformWaitEventsTimeout(timeout);
+}
+
+// Clears the key and mouse button edges of every window before a new event
+// processing pass, so that they describe only the changes made by that pass
+//
+static void resetInputEdges(void)
+{
+    _GLFWwindow* window;
+
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+    {
+        memset(window->keys.pressed, 0, sizeof(window->keys.pressed));
+        memset(window->keys.released, 0, sizeof(window->keys.released));
+        memset(window->mouseButtons.pressed, 0, sizeof(window->mouseButtons.pressed));
+        memset(window->mouseButtons.released, 0, sizeof(window->mouseButtons.released));
+    }
+}
+
+// Delivers the user events posted so far
+// Events posted by callbacks are left for the next event processing pass
+//
+static void dispatchUserEvents(void)
+{
+    unsigned int i;
+
+    // User events are not window system events and have no event time
+    _glfw.eventTime = 0.0;
+
+    // Clear the wakeup flag before draining so that a post racing with the
+    // drain signals the wait again instead of being missed
+    _glfwAtomicStore(&_glfw.userEvents.wakeup, 0);
+
+    for (i = 0;  i < _GLFW_USER_EVENT_COUNT;  i++)
+    {
+        const unsigned int pos = _glfw.userEvents.dequeuePos;
+        _GLFWusercell* cell = _glfw.userEvents.cells +
+                              (pos & (_GLFW_USER_EVENT_COUNT - 1));
+        void* payload;
+
+        if (_glfwAtomicLoad(&cell->sequence) != pos + 1)
+            break;
+
+        payload = cell->payload;
+        _glfw.userEvents.dequeuePos = pos + 1;
+
+        // Hand the cell back to the producers for the next lap of the ring
+        _glfwAtomicStore(&cell->sequence, pos + _GLFW_USER_EVENT_COUNT);
+
+        if (_glfw.callbacks.userEvent)
+            _glfw.callbacks.userEvent(payload);
+    }
+
+    if (i == _GLFW_USER_EVENT_COUNT &&
+        _glfwAtomicExchange(&_glfw.userEvents.wakeup, 1) == 0)
+    {
+        _glfwPlatformPostEmptyEvent();
+    }
+}
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -38,33 +110,39 @@
 
 void _glfwInputWindowFocus(_GLFWwindow* window, GLboolean focused)
 {
-    if (focused)
-    {
-        _glfw.focusedWindow = window;
+    GLFWevent* event;
 
-        if (window->callbacks.focus)
-            window->callbacks.focus((GLFWwindow*) window, focused);
-    }
-    else
+    _glfw.focusedWindow = focused ? window : NULL;
+
+    event = _glfwBufferEvent(window, GLFW_EVENT_WINDOW_FOCUS);
+    if (event)
+        event->data.state = focused;
+    else if (window->callbacks.focus)
+        window->callbacks.focus((GLFWwindow*) window, focused);
+
+    if (!focused)
     {
         int i;
 
-        _glfw.focusedWindow = NULL;
+        // Release all pressed keyboard keys, skipping words with no keys down
+        for (i = 0;  i < _GLFW_KEY_WORDS;  i++)
+        {
+            int j;
 
-        if (window->callbacks.focus)
-            window->callbacks.focus((GLFWwindow*) window, focused);
+            if (!window->keys.down[i])
+                continue;
 
-        // Release all pressed keyboard keys
-        for (i = 0;  i <= GLFW_KEY_LAST;  i++)
-        {
-            if (window->keys[i] == GLFW_PRESS)
-                _glfwInputKey(window, i, 0, GLFW_RELEASE, 0);
+            for (j = 0;  j < 32;  j++)
+            {
+                if (window->keys.down[i] & _GLFW_BIT(j))
+                    _glfwInputKey(window, i * 32 + j, 0, GLFW_RELEASE, 0);
+            }
         }
 
         // Release all pressed mouse buttons
         for (i = 0;  i <= GLFW_MOUSE_BUTTON_LAST;  i++)
         {
-            if (window->mouseButtons[i] == GLFW_PRESS)
+            if (_GLFW_GET_BIT(window->mouseButtons.down, i))
                 _glfwInputMouseClick(window, i, GLFW_RELEASE, 0);
         }
     }
@@ -72,120 +150,210 @@ void _glfwInputWindowFocus(_GLFWwindow* window, GLboolean focused)
 
 void _glfwInputWindowPos(_GLFWwindow* window, int x, int y)
 {
+    GLFWevent* event = _glfwBufferEvent(window, GLFW_EVENT_WINDOW_POS);
+    if (event)
+    {
+        event->data.pos.x = x;
+        event->data.pos.y = y;
+        return;
+    }
+
     if (window->callbacks.pos)
         window->callbacks.pos((GLFWwindow*) window, x, y);
 }
 
 void _glfwInputWindowSize(_GLFWwindow* window, int width, int height)
 {
+    GLFWevent* event = _glfwBufferEvent(window, GLFW_EVENT_WINDOW_SIZE);
+    if (event)
+    {
+        event->data.size.width = width;
+        event->data.size.height = height;
+        return;
+    }
+
     if (window->callbacks.size)
         window->callbacks.size((GLFWwindow*) window, width, height);
 }
 
 void _glfwInputWindowIconify(_GLFWwindow* window, int iconified)
 {
+    GLFWevent* event = _glfwBufferEvent(window, GLFW_EVENT_WINDOW_ICONIFY);
+    if (event)
+    {
+        event->data.state = iconified;
+        return;
+    }
+
     if (window->callbacks.iconify)
         window->callbacks.iconify((GLFWwindow*) window, iconified);
 }
 
 void _glfwInputFramebufferSize(_GLFWwindow* window, int width, int height)
 {
+    GLFWevent* event = _glfwBufferEvent(window, GLFW_EVENT_FRAMEBUFFER_SIZE);
+    if (event)
+    {
+        event->data.size.width = width;
+        event->data.size.height = height;
+        return;
+    }
+
     if (window->callbacks.fbsize)
         window->callbacks.fbsize((GLFWwindow*) window, width, height);
 }
 
 void _glfwInputWindowDamage(_GLFWwindow* window)
 {
+    if (_glfwBufferEvent(window, GLFW_EVENT_WINDOW_REFRESH))
+        return;
+
     if (window->callbacks.refresh)
         window->callbacks.refresh((GLFWwindow*) window);
 }
 
+void _glfwInputFrameTiming(_GLFWwindow* window,
+                           uint64_t ust, uint64_t msc, uint64_t sbc,
+                           double time)
+{
+    GLFWframetiming* frame = &window->frame;
+
+    // Swaps may be reported both by events and by queries, in any order
+    if (sbc <= frame->sbc)
+        return;
+
+    if (frame->sbc && msc > frame->msc)
+    {
+        // Each swap is due a swap interval after the previous one, so any
+        // retraces beyond that passed without a new frame
+        const uint64_t interval = window->swapInterval ?
+                                  abs(window->swapInterval) : 1;
+        const uint64_t expected = (sbc - frame->sbc) * interval;
+        const uint64_t elapsed = msc - frame->msc;
+
+        if (elapsed > expected)
+            frame->missedFrames += (int) (elapsed - expected);
+
+        if (ust > frame->ust)
+            frame->refreshPeriod = (ust - frame->ust) / (elapsed * 1e6);
+    }
+
+    frame->ust = ust;
+    frame->msc = msc;
+    frame->sbc = sbc;
+    frame->presentTime = time;
+}
+
+void _glfwInputFileDescriptor(int fd, int events)
+{
+    int i;
+
+    for (i = 0;  i < _glfw.watchCount;  i++)
+    {
+        if (_glfw.watches[i].fd == fd)
+        {
+            _glfw.watches[i].callback(fd, events);
+            return;
+        }
+    }
+}
+
 void _glfwInputWindowCloseRequest(_GLFWwindow* window)
 {
     window->closed = GL_TRUE;
 
+    if (_glfwBufferEvent(window, GLFW_EVENT_WINDOW_CLOSE))
+        return;
+
     if (window->callbacks.close)
         window->callbacks.close((GLFWwindow*) window);
 }
 
 
 //////////////////////////////////////////////////////////////////////////
-//////                        GLFW public API                       //////
+//////                       GLFW internal API                      //////
 //////////////////////////////////////////////////////////////////////////
 
-GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
-                                     const char* title,
-                                     GLFWmonitor* monitor,
-                                     GLFWwindow* share)
+GLFWevent* _glfwBufferEvent(_GLFWwindow* window, int type)
 {
-    _GLFWfbconfig fbconfig;
-    _GLFWctxconfig ctxconfig;
-    _GLFWwndconfig wndconfig;
-    _GLFWwindow* window;
-    _GLFWwindow* previous;
+    GLFWevent* event;
 
-    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    if (_glfw.events.count == _glfw.events.size)
+        return NULL;
 
-    if (width <= 0 || height <= 0)
-    {
-        _glfwInputError(GLFW_INVALID_VALUE, "Invalid window size");
+    // Events for a window being destroyed would be left holding a dangling
+    // handle, so they are dropped like any other event without a callback
+    if (window && window->destroying)
         return NULL;
-    }
 
-    fbconfig  = _glfw.hints.framebuffer;
-    ctxconfig = _glfw.hints.context;
-    wndconfig = _glfw.hints.window;
+    event = _glfw.events.buffer + _glfw.events.count++;
+    event->type = type;
+    event->window = (GLFWwindow*) window;
+    event->time = _glfw.eventTime ? _glfw.eventTime : _glfwPlatformGetTime();
+    return event;
+}
 
-    wndconfig.width   = width;
-    wndconfig.height  = height;
-    wndconfig.title   = title;
-    wndconfig.monitor = (_GLFWmonitor*) monitor;
-    ctxconfig.share   = (_GLFWwindow*) share;
+void _glfwInitUserEvents(void)
+{
+    unsigned int i;
 
-    if (wndconfig.monitor)
-    {
-        wndconfig.resizable = GL_TRUE;
-        wndconfig.visible   = GL_TRUE;
-        wndconfig.focused   = GL_TRUE;
-    }
+    for (i = 0;  i < _GLFW_USER_EVENT_COUNT;  i++)
+        _glfw.userEvents.cells[i].sequence = i;
+}
 
-    // Check the OpenGL bits of the window config
-    if (!_glfwIsValidContextConfig(&ctxconfig))
-        return NULL;
+_GLFWwindow* _glfwCreateWindow(const _GLFWwndconfig* wndconfig,
+                               const _GLFWctxconfig* ctxconfig,
+                               const _GLFWfbconfig* fbconfig,
+                               const _GLFWwindow* model)
+{
+    _GLFWwindow* window;
+    _GLFWwindow* previous;
 
     window = calloc(1, sizeof(_GLFWwindow));
     window->next = _glfw.windowListHead;
     _glfw.windowListHead = window;
 
-    window->videoMode.width       = width;
-    window->videoMode.height      = height;
-    window->videoMode.redBits     = fbconfig.redBits;
-    window->videoMode.greenBits   = fbconfig.greenBits;
-    window->videoMode.blueBits    = fbconfig.blueBits;
+    window->videoMode.width       = wndconfig->width;
+    window->videoMode.height      = wndconfig->height;
+    window->videoMode.redBits     = fbconfig->redBits;
+    window->videoMode.greenBits   = fbconfig->greenBits;
+    window->videoMode.blueBits    = fbconfig->blueBits;
     window->videoMode.refreshRate = _glfw.hints.refreshRate;
 
-    window->monitor     = wndconfig.monitor;
-    window->resizable   = wndconfig.resizable;
-    window->decorated   = wndconfig.decorated;
-    window->autoIconify = wndconfig.autoIconify;
-    window->floating    = wndconfig.floating;
+    window->monitor     = wndconfig->monitor;
+    window->resizable   = wndconfig->resizable;
+    window->decorated   = wndconfig->decorated;
+    window->autoIconify = wndconfig->autoIconify;
+    window->floating    = wndconfig->floating;
+    window->offscreen   = wndconfig->offscreen;
     window->cursorMode  = GLFW_CURSOR_NORMAL;
 
     // Save the currently current context so it can be restored later
     previous = _glfwPlatformGetCurrentContext();
 
     // Open the actual window and create its context
-    if (!_glfwPlatformCreateWindow(window, &wndconfig, &ctxconfig, &fbconfig))
+    if (!_glfwPlatformCreateWindow(window, wndconfig, ctxconfig, fbconfig))
     {
         glfwDestroyWindow((GLFWwindow*) window);
         _glfwPlatformMakeContextCurrent(previous);
         return NULL;
     }
 
+    if (model)
+    {
+        // The context was created from the same configs as the model, so its
+        // attributes are already known and it need not be made current
+        window->context = model->context;
+#if defined(_GLFW_USE_OPENGL)
+        window->GetStringi = model->GetStringi;
+#endif
+        return window;
+    }
+
     _glfwPlatformMakeContextCurrent(window);
 
     // Retrieve the actual (as opposed to requested) context attributes
-    if (!_glfwRefreshContextAttribs(&ctxconfig))
+    if (!_glfwRefreshContextAttribs(ctxconfig))
     {
         glfwDestroyWindow((GLFWwindow*) window);
         _glfwPlatformMakeContextCurrent(previous);
@@ -193,22 +361,25 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     }
 
     // Verify the context against the requested parameters
-    if (!_glfwIsValidContext(&ctxconfig))
+    if (!_glfwIsValidContext(ctxconfig))
     {
         glfwDestroyWindow((GLFWwindow*) window);
         _glfwPlatformMakeContextCurrent(previous);
         return NULL;
     }
 
-    // Clearing the front buffer to black to avoid garbage pixels left over
-    // from previous uses of our bit of VRAM
-    glClear(GL_COLOR_BUFFER_BIT);
-    _glfwPlatformSwapBuffers(window);
+    if (!window->offscreen)
+    {
+        // Clearing the front buffer to black to avoid garbage pixels left over
+        // from previous uses of our bit of VRAM
+        glClear(GL_COLOR_BUFFER_BIT);
+        _glfwPlatformSwapBuffers(window);
+    }
 
     // Restore the previously current context (or NULL)
     _glfwPlatformMakeContextCurrent(previous);
 
-    if (wndconfig.monitor)
+    if (wndconfig->monitor)
     {
         int width, height;
         _glfwPlatformGetWindowSize(window, &width, &height);
@@ -218,18 +389,71 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
 
         _glfwPlatformSetCursorPos(window, window->cursorPosX, window->cursorPosY);
     }
-    else
+    else if (!window->offscreen)
     {
-        if (wndconfig.visible)
+        if (wndconfig->visible)
         {
-            if (wndconfig.focused)
+            if (wndconfig->focused)
                 _glfwPlatformShowWindow(window);
             else
                 _glfwPlatformUnhideWindow(window);
         }
     }
 
-    return (GLFWwindow*) window;
+    return window;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GLFW public API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
+                                     const char* title,
+                                     GLFWmonitor* monitor,
+                                     GLFWwindow* share)
+{
+    _GLFWfbconfig fbconfig;
+    _GLFWctxconfig ctxconfig;
+    _GLFWwndconfig wndconfig;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    if (width <= 0 || height <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid window size");
+        return NULL;
+    }
+
+    fbconfig  = _glfw.hints.framebuffer;
+    ctxconfig = _glfw.hints.context;
+    wndconfig = _glfw.hints.window;
+
+    wndconfig.width   = width;
+    wndconfig.height  = height;
+    wndconfig.title   = title;
+    wndconfig.monitor = (_GLFWmonitor*) monitor;
+    ctxconfig.share   = (_GLFWwindow*) share;
+
+    if (wndconfig.monitor)
+    {
+        if (wndconfig.offscreen)
+        {
+            _glfwInputError(GLFW_INVALID_VALUE,
+                            "Offscreen windows cannot be full screen");
+            return NULL;
+        }
+
+        wndconfig.resizable = GL_TRUE;
+        wndconfig.visible   = GL_TRUE;
+        wndconfig.focused   = GL_TRUE;
+    }
+
+    // Check the OpenGL bits of the window config
+    if (!_glfwIsValidContextConfig(&ctxconfig))
+        return NULL;
+
+    return (GLFWwindow*) _glfwCreateWindow(&wndconfig, &ctxconfig, &fbconfig, NULL);
 }
 
 void glfwDefaultWindowHints(void)
@@ -333,6 +557,9 @@ GLFWAPI void glfwWindowHint(int target, int hint)
         case GLFW_VISIBLE:
             _glfw.hints.window.visible = hint ? GL_TRUE : GL_FALSE;
             break;
+        case GLFW_OFFSCREEN:
+            _glfw.hints.window.offscreen = hint ? GL_TRUE : GL_FALSE;
+            break;
         case GLFW_CLIENT_API:
             _glfw.hints.context.api = hint;
             break;
@@ -376,8 +603,29 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
     if (window == NULL)
         return;
 
+    if (window->pool)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Pooled contexts are destroyed with their pool");
+        return;
+    }
+
     // Clear all callbacks to avoid exposing a half torn-down window object
     memset(&window->callbacks, 0, sizeof(window->callbacks));
+    window->destroying = GL_TRUE;
+
+    // Remove any events already buffered for this window
+    {
+        int i, count = 0;
+
+        for (i = 0;  i < _glfw.events.count;  i++)
+        {
+            if (_glfw.events.buffer[i].window != handle)
+                _glfw.events.buffer[count++] = _glfw.events.buffer[i];
+        }
+
+        _glfw.events.count = count;
+    }
 
     // The window's context must not be current on another thread when the
     // window is destroyed
@@ -400,6 +648,7 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
         *prev = window->next;
     }
 
+    _glfwFreeExtensionSet(&window->extensions);
     free(window);
 }
 
@@ -420,7 +669,12 @@ GLFWAPI void glfwSetWindowShouldClose(GLFWwindow* handle, int value)
 GLFWAPI void glfwSetWindowTitle(GLFWwindow* handle, const char* title)
 {
     _GLFWwindow* window = (_GLFWwindow*) handle;
+
     _GLFW_REQUIRE_INIT();
+
+    if (window->offscreen)
+        return;
+
     _glfwPlatformSetWindowTitle(window, title);
 }
 
@@ -434,6 +688,10 @@ GLFWAPI void glfwGetWindowPos(GLFWwindow* handle, int* xpos, int* ypos)
         *ypos = 0;
 
     _GLFW_REQUIRE_INIT();
+
+    if (window->offscreen)
+        return;
+
     _glfwPlatformGetWindowPos(window, xpos, ypos);
 }
 
@@ -450,6 +708,9 @@ GLFWAPI void glfwSetWindowPos(GLFWwindow* handle, int xpos, int ypos)
         return;
     }
 
+    if (window->offscreen)
+        return;
+
     _glfwPlatformSetWindowPos(window, xpos, ypos);
 }
 
@@ -463,6 +724,18 @@ GLFWAPI void glfwGetWindowSize(GLFWwindow* handle, int* width, int* height)
         *height = 0;
 
     _GLFW_REQUIRE_INIT();
+
+    if (window->offscreen)
+    {
+        // The size of an offscreen window is fixed at creation
+        if (width)
+            *width = window->videoMode.width;
+        if (height)
+            *height = window->videoMode.height;
+
+        return;
+    }
+
     _glfwPlatformGetWindowSize(window, width, height);
 }
 
@@ -472,6 +745,9 @@ GLFWAPI void glfwSetWindowSize(GLFWwindow* handle, int width, int height)
 
     _GLFW_REQUIRE_INIT();
 
+    if (window->offscreen)
+        return;
+
     if (window->monitor)
     {
         window->videoMode.width  = width;
@@ -491,6 +767,17 @@ GLFWAPI void glfwGetFramebufferSize(GLFWwindow* handle, int* width, int* height)
         *height = 0;
 
     _GLFW_REQUIRE_INIT();
+
+    if (window->offscreen)
+    {
+        if (width)
+            *width = window->videoMode.width;
+        if (height)
+            *height = window->videoMode.height;
+
+        return;
+    }
+
     _glfwPlatformGetFramebufferSize(window, width, height);
 }
 
@@ -510,20 +797,34 @@ GLFWAPI void glfwGetWindowFrameSize(GLFWwindow* handle,
         *bottom = 0;
 
     _GLFW_REQUIRE_INIT();
+
+    if (window->offscreen)
+        return;
+
     _glfwPlatformGetWindowFrameSize(window, left, top, right, bottom);
 }
 
 GLFWAPI void glfwIconifyWindow(GLFWwindow* handle)
 {
     _GLFWwindow* window = (_GLFWwindow*) handle;
+
     _GLFW_REQUIRE_INIT();
+
+    if (window->offscreen)
+        return;
+
     _glfwPlatformIconifyWindow(window);
 }
 
 GLFWAPI void glfwRestoreWindow(GLFWwindow* handle)
 {
     _GLFWwindow* window = (_GLFWwindow*) handle;
+
     _GLFW_REQUIRE_INIT();
+
+    if (window->offscreen)
+        return;
+
     _glfwPlatformRestoreWindow(window);
 }
 
@@ -533,7 +834,7 @@ GLFWAPI void glfwShowWindow(GLFWwindow* handle)
 
     _GLFW_REQUIRE_INIT();
 
-    if (window->monitor)
+    if (window->monitor || window->offscreen)
         return;
 
     _glfwPlatformShowWindow(window);
@@ -545,7 +846,7 @@ GLFWAPI void glfwHideWindow(GLFWwindow* handle)
 
     _GLFW_REQUIRE_INIT();
 
-    if (window->monitor)
+    if (window->monitor || window->offscreen)
         return;
 
     _glfwPlatformHideWindow(window);
@@ -560,11 +861,19 @@ GLFWAPI int glfwGetWindowAttrib(GLFWwindow* handle, int attrib)
     switch (attrib)
     {
         case GLFW_FOCUSED:
+            if (window->offscreen)
+                return GL_FALSE;
             return _glfwPlatformWindowFocused(window);
         case GLFW_ICONIFIED:
+            if (window->offscreen)
+                return GL_FALSE;
             return _glfwPlatformWindowIconified(window);
         case GLFW_VISIBLE:
+            if (window->offscreen)
+                return GL_FALSE;
             return _glfwPlatformWindowVisible(window);
+        case GLFW_OFFSCREEN:
+            return window->offscreen;
         case GLFW_RESIZABLE:
             return window->resizable;
         case GLFW_DECORATED:
@@ -682,7 +991,10 @@ GLFWAPI GLFWframebuffersizefun glfwSetFramebufferSizeCallback(GLFWwindow* handle
 GLFWAPI void glfwPollEvents(void)
 {
     _GLFW_REQUIRE_INIT();
+    resetInputEdges();
     _glfwPlatformPollEvents();
+    _glfwFlushCursorMotion();
+    dispatchUserEvents();
 }
 
 GLFWAPI void glfwWaitEvents(void)
@@ -692,7 +1004,108 @@ GLFWAPI void glfwWaitEvents(void)
     if (!_glfw.windowListHead)
         return;
 
+    resetInputEdges();
     _glfwPlatformWaitEvents();
+    _glfwFlushCursorMotion();
+    dispatchUserEvents();
+}
+
+GLFWAPI void glfwWaitEventsTimeout(double timeout)
+{
+    _GLFW_REQUIRE_INIT();
+
+    if (timeout != timeout || timeout < 0.0 || timeout > DBL_MAX)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid time %f", timeout);
+        return;
+    }
+
+    resetInputEdges();
+    waitEventsTimeout(timeout);
+    _glfwFlushCursorMotion();
+    dispatchUserEvents();
+}
+
+GLFWAPI void glfwWaitEventsUntil(double time)
+{
+    double timeout;
+
+    _GLFW_REQUIRE_INIT();
+
+    if (time != time || time < -DBL_MAX || time > DBL_MAX)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid time %f", time);
+        return;
+    }
+
+    resetInputEdges();
+
+    // A deadline that has already passed still processes pending events
+    timeout = time - _glfwPlatformGetTime();
+    if (timeout > 0.0)
+        waitEventsTimeout(timeout);
+    else
+        _glfwPlatformPollEvents();
+
+    _glfwFlushCursorMotion();
+    dispatchUserEvents();
+}
+
+GLFWAPI GLFWfdfun glfwSetFileDescriptorCallback(int fd, int events,
+                                                GLFWfdfun cbfun)
+{
+    int i;
+    GLFWfdfun previous = NULL;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    if (fd < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid file descriptor %i", fd);
+        return NULL;
+    }
+
+    if (events & ~(GLFW_FD_READABLE | GLFW_FD_WRITABLE))
+    {
+        _glfwInputError(GLFW_INVALID_ENUM,
+                        "Invalid file descriptor events 0x%08X", events);
+        return NULL;
+    }
+
+    for (i = 0;  i < _glfw.watchCount;  i++)
+    {
+        if (_glfw.watches[i].fd == fd)
+        {
+            previous = _glfw.watches[i].callback;
+            break;
+        }
+    }
+
+    if (cbfun)
+    {
+        if (!_glfwPlatformWatchFileDescriptor(fd, events))
+            return NULL;
+
+        if (i == _glfw.watchCount)
+        {
+            _glfw.watches = realloc(_glfw.watches,
+                                    sizeof(_GLFWwatch) * (_glfw.watchCount + 1));
+            _glfw.watchCount++;
+        }
+
+        _glfw.watches[i].fd = fd;
+        _glfw.watches[i].events = events;
+        _glfw.watches[i].callback = cbfun;
+    }
+    else if (i < _glfw.watchCount)
+    {
+        _glfwPlatformUnwatchFileDescriptor(fd);
+
+        _glfw.watchCount--;
+        _glfw.watches[i] = _glfw.watches[_glfw.watchCount];
+    }
+
+    return previous;
 }
 
 GLFWAPI void glfwPostEmptyEvent(void)
@@ -705,3 +1118,76 @@ GLFWAPI void glfwPostEmptyEvent(void)
     _glfwPlatformPostEmptyEvent();
 }
 
+GLFWAPI int glfwPostUserEvent(void* payload)
+{
+    unsigned int pos;
+    _GLFWusercell* cell;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GL_FALSE);
+
+    // This is a bounded multi-producer queue where each cell carries
+    // a sequence number telling producers and the consumer whose turn it is
+    pos = _glfwAtomicLoad(&_glfw.userEvents.enqueuePos);
+
+    for (;;)
+    {
+        int diff;
+
+        cell = _glfw.userEvents.cells + (pos & (_GLFW_USER_EVENT_COUNT - 1));
+        diff = (int) (_glfwAtomicLoad(&cell->sequence) - pos);
+
+        if (diff == 0)
+        {
+            if (_glfwAtomicCompareExchange(&_glfw.userEvents.enqueuePos,
+                                           pos, pos + 1))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The cell has not yet been consumed since the previous lap
+            return GL_FALSE;
+        }
+
+        pos = _glfwAtomicLoad(&_glfw.userEvents.enqueuePos);
+    }
+
+    cell->payload = payload;
+    _glfwAtomicStore(&cell->sequence, pos + 1);
+
+    // Only the first post since the last drain needs to wake the main thread
+    if (_glfwAtomicExchange(&_glfw.userEvents.wakeup, 1) == 0)
+        _glfwPlatformPostEmptyEvent();
+
+    return GL_TRUE;
+}
+
+GLFWAPI GLFWusereventfun glfwSetUserEventCallback(GLFWusereventfun cbfun)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    _GLFW_SWAP_POINTERS(_glfw.callbacks.userEvent, cbfun);
+    return cbfun;
+}
+
+GLFWAPI int glfwSetEventBuffer(GLFWevent* events, int size)
+{
+    int count;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (size < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid event buffer size %i", size);
+        return 0;
+    }
+
+    count = _glfw.events.count;
+
+    _glfw.events.buffer = events;
+    _glfw.events.size = events ? size : 0;
+    _glfw.events.count = 0;
+
+    return count;
+}
+
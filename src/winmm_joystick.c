@@ -175,3 +175,18 @@ const char* _glfwPlatformGetJoystickName(int joy)
     return _glfw.winmm_js[joy].name;
 }
 
+double _glfwPlatformGetJoystickTimestamp(int joy)
+{
+    // WinMM joystick state is sampled when queried
+    if (!_glfwPlatformJoystickPresent(joy))
+        return 0.0;
+
+    return _glfwPlatformGetTime();
+}
+
+int _glfwPlatformGetJoystickEvents(int joy, GLFWjoystickevent* events, int count)
+{
+    // Joystick state is sampled when queried, so there is no event history
+    return 0;
+}
+
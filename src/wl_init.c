@@ -48,6 +48,8 @@ static void pointerHandleEnter(void* data,
     _glfw.wl.pointerSerial = serial;
     _glfw.wl.pointerFocus = window;
 
+    _glfwInputEventTime(0.0);
+
     _glfwPlatformSetCursor(window, window->wl.currentCursor);
     _glfwInputCursorEnter(window, GL_TRUE);
 }
@@ -64,6 +66,7 @@ static void pointerHandleLeave(void* data,
 
     _glfw.wl.pointerSerial = serial;
     _glfw.wl.pointerFocus = NULL;
+    _glfwInputEventTime(0.0);
     _glfwInputCursorEnter(window, GL_FALSE);
 }
 
@@ -91,6 +94,7 @@ static void pointerHandleMotion(void* data,
         window->wl.cursorPosY = wl_fixed_to_double(sy);
     }
 
+    _glfwInputEventTime(_glfwConvertMillisecondTimestamp(time));
     _glfwInputCursorMotion(window,
                            wl_fixed_to_double(sx),
                            wl_fixed_to_double(sy));
@@ -113,6 +117,7 @@ static void pointerHandleButton(void* data,
      * codes. */
     glfwButton = button - BTN_LEFT;
 
+    _glfwInputEventTime(_glfwConvertMillisecondTimestamp(time));
     _glfwInputMouseClick(window,
                          glfwButton,
                          state == WL_POINTER_BUTTON_STATE_PRESSED
@@ -153,6 +158,7 @@ static void pointerHandleAxis(void* data,
             break;
     }
 
+    _glfwInputEventTime(_glfwConvertMillisecondTimestamp(time));
     _glfwInputScroll(window, x, y);
 }
 
@@ -233,6 +239,7 @@ static void keyboardHandleEnter(void* data,
     _GLFWwindow* window = wl_surface_get_user_data(surface);
 
     _glfw.wl.keyboardFocus = window;
+    _glfwInputEventTime(0.0);
     _glfwInputWindowFocus(window, GL_TRUE);
 }
 
@@ -247,6 +254,7 @@ static void keyboardHandleLeave(void* data,
         return;
 
     _glfw.wl.keyboardFocus = NULL;
+    _glfwInputEventTime(0.0);
     _glfwInputWindowFocus(window, GL_FALSE);
 }
 
@@ -395,6 +403,7 @@ static void keyboardHandleKey(void* data,
     action = state == WL_KEYBOARD_KEY_STATE_PRESSED
             ? GLFW_PRESS : GLFW_RELEASE;
 
+    _glfwInputEventTime(_glfwConvertMillisecondTimestamp(time));
     _glfwInputKey(window, keyCode, key, action,
                   _glfw.wl.xkb.modifiers);
 
@@ -577,6 +586,9 @@ int _glfwPlatformInit(void)
     _glfwInitTimer();
     _glfwInitJoysticks();
 
+    if (!_glfwInitWait(wl_display_get_fd(_glfw.wl.display)))
+        return GL_FALSE;
+
     if (_glfw.wl.pointer && _glfw.wl.shm)
     {
         _glfw.wl.cursorTheme = wl_cursor_theme_load(NULL, 32, _glfw.wl.shm);
@@ -604,6 +616,7 @@ int _glfwPlatformInit(void)
 void _glfwPlatformTerminate(void)
 {
     _glfwTerminateContextAPI();
+    _glfwTerminateWait();
     _glfwTerminateJoysticks();
 
     if (_glfw.wl.cursorTheme)
@@ -627,7 +640,7 @@ const char* _glfwPlatformGetVersionString(void)
         " gettimeofday"
 #endif
 #if defined(__linux__)
-        " /dev/js"
+        " evdev"
 #endif
 #if defined(_GLFW_BUILD_DLL)
         " shared"
@@ -32,6 +32,7 @@
 
 #include "posix_tls.h"
 #include "posix_time.h"
+#include "posix_wait.h"
 #include "linux_joystick.h"
 #include "xkb_unicode.h"
 
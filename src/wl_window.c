@@ -35,7 +35,6 @@
 #include <string.h>
 #include <fcntl.h>
 #include <sys/mman.h>
-#include <poll.h>
 
 #include <wayland-egl.h>
 #include <wayland-cursor.h>
@@ -55,6 +54,7 @@ static void handleConfigure(void* data,
                             int32_t height)
 {
     _GLFWwindow* window = data;
+    _glfwInputEventTime(0.0);
     _glfwInputFramebufferSize(window, width, height);
     _glfwInputWindowSize(window, width, height);
     _glfwPlatformSetWindowSize(window, width, height);
@@ -115,12 +115,9 @@ createTmpfileCloexec(char* tmpname)
 }
 
 static void
-handleEvents(int timeout)
+handleEvents(double timeout)
 {
     struct wl_display* display = _glfw.wl.display;
-    struct pollfd fds[] = {
-        { wl_display_get_fd(display), POLLIN },
-    };
 
     while (wl_display_prepare_read(display) != 0)
         wl_display_dispatch_pending(display);
@@ -140,7 +137,7 @@ handleEvents(int timeout)
         return;
     }
 
-    if (poll(fds, 1, timeout) > 0)
+    if (_glfwWaitForEvents(timeout))
     {
         wl_display_read_events(display);
         wl_display_dispatch_pending(display);
@@ -149,6 +146,9 @@ handleEvents(int timeout)
     {
         wl_display_cancel_read(display);
     }
+
+    _glfwPollJoystickEvents();
+    _glfwPollWatchedEvents();
 }
 
 /*
@@ -219,6 +219,10 @@ int _glfwPlatformCreateWindow(_GLFWwindow* window,
     if (!_glfwCreateContext(window, ctxconfig, fbconfig))
         return GL_FALSE;
 
+    // Offscreen windows have no Wayland surface
+    if (wndconfig->offscreen)
+        return GL_TRUE;
+
     if (!createSurface(window, wndconfig))
         return GL_FALSE;
 
@@ -364,17 +368,22 @@ int _glfwPlatformWindowVisible(_GLFWwindow* window)
 
 void _glfwPlatformPollEvents(void)
 {
-    handleEvents(0);
+    handleEvents(0.0);
 }
 
 void _glfwPlatformWaitEvents(void)
 {
-    handleEvents(-1);
+    handleEvents(-1.0);
+}
+
+void _glfwPlatformWaitEventsTimeout(double timeout)
+{
+    handleEvents(timeout);
 }
 
 void _glfwPlatformPostEmptyEvent(void)
 {
-    wl_display_sync(_glfw.wl.display);
+    _glfwSignalWait();
 }
 
 void _glfwPlatformGetCursorPos(_GLFWwindow* window, double* xpos, double* ypos)
@@ -522,6 +531,18 @@ void _glfwPlatformSetClipboardString(_GLFWwindow* window, const char* string)
     fprintf(stderr, "_glfwPlatformSetClipboardString not implemented yet\n");
 }
 
+void _glfwPlatformSetClipboardData(_GLFWwindow* window,
+                                   const char** types, int count,
+                                   void* data, size_t size,
+                                   GLFWclipboardfreefun cbfun)
+{
+    _glfwInputError(GLFW_PLATFORM_ERROR,
+                    "Wayland: Clipboard data is not supported yet");
+
+    if (cbfun)
+        cbfun(data);
+}
+
 const char* _glfwPlatformGetClipboardString(_GLFWwindow* window)
 {
     // TODO
@@ -529,3 +550,8 @@ const char* _glfwPlatformGetClipboardString(_GLFWwindow* window)
     return NULL;
 }
 
+void _glfwPlatformRequestClipboardString(_GLFWwindow* window)
+{
+    _glfwInputClipboardString(window, _glfwPlatformGetClipboardString(window));
+}
+
@@ -35,6 +35,9 @@
 #include <stdio.h>
 #include <locale.h>
 
+// The XKB key name to GLFW key table is generated from the list in keytables.c
+#include "x11_keyname_table.h"
+
 
 // Translate an X11 key code to a GLFW key code.
 //
@@ -240,7 +243,6 @@ static void createKeyTables(void)
         // Use XKB to determine physical key locations independently of the current
         // keyboard layout
 
-        char name[XkbKeyNameLength + 1];
         XkbDescPtr descr = XkbGetKeyboard(_glfw.x11.display,
                                           XkbAllComponentsMask,
                                           XkbUseCoreKbd);
@@ -248,62 +250,25 @@ static void createKeyTables(void)
         // Find the X11 key code -> GLFW key code mapping
         for (scancode = descr->min_key_code;  scancode <= descr->max_key_code;  scancode++)
         {
-            memcpy(name, descr->names->keys[scancode].name, XkbKeyNameLength);
-            name[XkbKeyNameLength] = 0;
+            int i;
+            unsigned int name = 0, hash;
+            const char* chars = descr->names->keys[scancode].name;
 
             // Map the key name to a GLFW key code. Note: We only map printable
             // keys here, and we use the US keyboard layout. The rest of the
             // keys (function keys) are mapped using traditional KeySym
             // translations.
-            if (strcmp(name, "TLDE") == 0) key = GLFW_KEY_GRAVE_ACCENT;
-            else if (strcmp(name, "AE01") == 0) key = GLFW_KEY_1;
-            else if (strcmp(name, "AE02") == 0) key = GLFW_KEY_2;
-            else if (strcmp(name, "AE03") == 0) key = GLFW_KEY_3;
-            else if (strcmp(name, "AE04") == 0) key = GLFW_KEY_4;
-            else if (strcmp(name, "AE05") == 0) key = GLFW_KEY_5;
-            else if (strcmp(name, "AE06") == 0) key = GLFW_KEY_6;
-            else if (strcmp(name, "AE07") == 0) key = GLFW_KEY_7;
-            else if (strcmp(name, "AE08") == 0) key = GLFW_KEY_8;
-            else if (strcmp(name, "AE09") == 0) key = GLFW_KEY_9;
-            else if (strcmp(name, "AE10") == 0) key = GLFW_KEY_0;
-            else if (strcmp(name, "AE11") == 0) key = GLFW_KEY_MINUS;
-            else if (strcmp(name, "AE12") == 0) key = GLFW_KEY_EQUAL;
-            else if (strcmp(name, "AD01") == 0) key = GLFW_KEY_Q;
-            else if (strcmp(name, "AD02") == 0) key = GLFW_KEY_W;
-            else if (strcmp(name, "AD03") == 0) key = GLFW_KEY_E;
-            else if (strcmp(name, "AD04") == 0) key = GLFW_KEY_R;
-            else if (strcmp(name, "AD05") == 0) key = GLFW_KEY_T;
-            else if (strcmp(name, "AD06") == 0) key = GLFW_KEY_Y;
-            else if (strcmp(name, "AD07") == 0) key = GLFW_KEY_U;
-            else if (strcmp(name, "AD08") == 0) key = GLFW_KEY_I;
-            else if (strcmp(name, "AD09") == 0) key = GLFW_KEY_O;
-            else if (strcmp(name, "AD10") == 0) key = GLFW_KEY_P;
-            else if (strcmp(name, "AD11") == 0) key = GLFW_KEY_LEFT_BRACKET;
-            else if (strcmp(name, "AD12") == 0) key = GLFW_KEY_RIGHT_BRACKET;
-            else if (strcmp(name, "AC01") == 0) key = GLFW_KEY_A;
-            else if (strcmp(name, "AC02") == 0) key = GLFW_KEY_S;
-            else if (strcmp(name, "AC03") == 0) key = GLFW_KEY_D;
-            else if (strcmp(name, "AC04") == 0) key = GLFW_KEY_F;
-            else if (strcmp(name, "AC05") == 0) key = GLFW_KEY_G;
-            else if (strcmp(name, "AC06") == 0) key = GLFW_KEY_H;
-            else if (strcmp(name, "AC07") == 0) key = GLFW_KEY_J;
-            else if (strcmp(name, "AC08") == 0) key = GLFW_KEY_K;
-            else if (strcmp(name, "AC09") == 0) key = GLFW_KEY_L;
-            else if (strcmp(name, "AC10") == 0) key = GLFW_KEY_SEMICOLON;
-            else if (strcmp(name, "AC11") == 0) key = GLFW_KEY_APOSTROPHE;
-            else if (strcmp(name, "AB01") == 0) key = GLFW_KEY_Z;
-            else if (strcmp(name, "AB02") == 0) key = GLFW_KEY_X;
-            else if (strcmp(name, "AB03") == 0) key = GLFW_KEY_C;
-            else if (strcmp(name, "AB04") == 0) key = GLFW_KEY_V;
-            else if (strcmp(name, "AB05") == 0) key = GLFW_KEY_B;
-            else if (strcmp(name, "AB06") == 0) key = GLFW_KEY_N;
-            else if (strcmp(name, "AB07") == 0) key = GLFW_KEY_M;
-            else if (strcmp(name, "AB08") == 0) key = GLFW_KEY_COMMA;
-            else if (strcmp(name, "AB09") == 0) key = GLFW_KEY_PERIOD;
-            else if (strcmp(name, "AB10") == 0) key = GLFW_KEY_SLASH;
-            else if (strcmp(name, "BKSL") == 0) key = GLFW_KEY_BACKSLASH;
-            else if (strcmp(name, "LSGT") == 0) key = GLFW_KEY_WORLD_1;
-            else key = GLFW_KEY_UNKNOWN;
+            // The name is packed and hashed as in keytables.c
+            for (i = 0;  i < XkbKeyNameLength && chars[i];  i++)
+                name |= (unsigned int) (unsigned char) chars[i] << (i * 8);
+
+            hash = (name * _GLFW_KEYNAME_HASH_MULTIPLIER) >>
+                   _GLFW_KEYNAME_HASH_SHIFT;
+
+            if (keynametab[hash].name == name)
+                key = keynametab[hash].key;
+            else
+                key = GLFW_KEY_UNKNOWN;
 
             if ((scancode >= 0) && (scancode < 256))
                 _glfw.x11.publicKeys[scancode] = key;
@@ -463,6 +428,23 @@ static void detectEWMH(void)
     _glfw.x11.hasEWMH = GL_TRUE;
 }
 
+// Returns the largest number of bytes of selection data to send in a single
+// property change
+//
+static size_t getSelectionChunkSize(void)
+{
+    // The maximum request size is in four byte units and includes the header
+    long size = XExtendedMaxRequestSize(_glfw.x11.display);
+    if (!size)
+        size = XMaxRequestSize(_glfw.x11.display);
+
+    size = size * 4 - 256;
+    if (size > _GLFW_X11_SELECTION_CHUNK_SIZE)
+        size = _GLFW_X11_SELECTION_CHUNK_SIZE;
+
+    return (size_t) size;
+}
+
 // Initialize X11 display and look for supported X11 extensions
 //
 static GLboolean initExtensions(void)
@@ -590,6 +572,7 @@ static GLboolean initExtensions(void)
     _glfw.x11.COMPOUND_STRING =
         XInternAtom(_glfw.x11.display, "COMPOUND_STRING", False);
     _glfw.x11.ATOM_PAIR = XInternAtom(_glfw.x11.display, "ATOM_PAIR", False);
+    _glfw.x11.INCR = XInternAtom(_glfw.x11.display, "INCR", False);
 
     // Find or create selection property atom
     _glfw.x11.GLFW_SELECTION =
@@ -600,6 +583,9 @@ static GLboolean initExtensions(void)
     _glfw.x11.MULTIPLE = XInternAtom(_glfw.x11.display, "MULTIPLE", False);
     _glfw.x11.CLIPBOARD = XInternAtom(_glfw.x11.display, "CLIPBOARD", False);
 
+    // Selection data larger than this is sent incrementally
+    _glfw.x11.selectionChunkSize = getSelectionChunkSize();
+
     // Find or create clipboard manager atoms
     _glfw.x11.CLIPBOARD_MANAGER =
         XInternAtom(_glfw.x11.display, "CLIPBOARD_MANAGER", False);
@@ -752,10 +738,13 @@ int _glfwPlatformInit(void)
     if (!_glfwInitContextAPI())
         return GL_FALSE;
 
+    _glfwInitTimer();
+
     if (!_glfwInitJoysticks())
         return GL_FALSE;
 
-    _glfwInitTimer();
+    if (!_glfwInitWait(ConnectionNumber(_glfw.x11.display)))
+        return GL_FALSE;
 
     return GL_TRUE;
 }
@@ -770,12 +759,25 @@ void _glfwPlatformTerminate(void)
 
     free(_glfw.x11.clipboardString);
 
+    while (_glfw.x11.transferListHead)
+    {
+        _GLFWtransferX11* transfer = _glfw.x11.transferListHead;
+        _glfw.x11.transferListHead = transfer->next;
+
+        _glfwReleaseSelection(transfer->selection);
+        free(transfer);
+    }
+
+    _glfwReleaseSelection(_glfw.x11.selection);
+    _glfw.x11.selection = NULL;
+
     if (_glfw.x11.im)
     {
         XCloseIM(_glfw.x11.im);
         _glfw.x11.im = NULL;
     }
 
+    _glfwTerminateWait();
     _glfwTerminateJoysticks();
     _glfwTerminateContextAPI();
 
@@ -800,7 +802,7 @@ const char* _glfwPlatformGetVersionString(void)
         " gettimeofday"
 #endif
 #if defined(__linux__)
-        " /dev/js"
+        " evdev"
 #endif
 #if defined(_GLFW_BUILD_DLL)
         " shared"
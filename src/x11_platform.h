@@ -58,6 +58,7 @@
 
 #include "posix_tls.h"
 #include "posix_time.h"
+#include "posix_wait.h"
 #include "linux_joystick.h"
 #include "xkb_unicode.h"
 
@@ -78,6 +79,12 @@
 #define _GLFW_PLATFORM_MONITOR_STATE        _GLFWmonitorX11 x11
 #define _GLFW_PLATFORM_CURSOR_STATE         _GLFWcursorX11  x11
 
+// Number of slots in the window lookup cache, must be a power of two
+#define _GLFW_X11_WINDOW_CACHE_SIZE 64
+
+// Largest number of bytes of selection data sent in a single property change
+#define _GLFW_X11_SELECTION_CHUNK_SIZE (256 * 1024)
+
 
 // X11-specific per-window data
 //
@@ -95,9 +102,29 @@ typedef struct _GLFWwindowX11
 
     // The last received cursor position, regardless of source
     double          cursorPosX, cursorPosY;
+    // True if the above is current and can be returned without a round trip
+    GLboolean       cursorPosValid;
     // The last position the cursor was warped to by GLFW
     int             warpPosX, warpPosY;
 
+    // Pending clipboard request
+    struct {
+        // The target being converted, or None if no request is pending
+        Atom        target;
+        // True if data targets are tried in order, as TARGETS failed
+        GLboolean   fallback;
+        // True if the result goes to the clipboard callback
+        GLboolean   async;
+        // The time on the GLFW timer when the request is abandoned
+        double      deadline;
+        // True if the data is being received incrementally (INCR)
+        GLboolean   incr;
+        // The data received so far by an incremental transfer
+        char*       data;
+        size_t      length;
+        size_t      capacity;
+    } clipboard;
+
 } _GLFWwindowX11;
 
 
@@ -115,12 +142,20 @@ typedef struct _GLFWlibraryX11
     XContext        context;
     // XIM input method
     XIM             im;
+    // Union of the event masks the input contexts want to filter
+    unsigned long   imFilterMask;
     // True if window manager supports EWMH
     GLboolean       hasEWMH;
     // Most recent error code received by X error handler
     int             errorCode;
-    // Clipboard string (while the selection is owned)
+    // Clipboard contents (while the selection is owned)
+    struct _GLFWselectionX11* selection;
+    // Clipboard string most recently retrieved by glfwGetClipboardString
     char*           clipboardString;
+    // Clipboard contents being sent incrementally (INCR) to other clients
+    struct _GLFWtransferX11* transferListHead;
+    // Largest number of bytes to send in a single property change
+    size_t          selectionChunkSize;
     // X11 keycode to GLFW key LUT
     short int       publicKeys[256];
 
@@ -163,6 +198,7 @@ typedef struct _GLFWlibraryX11
     Atom            UTF8_STRING;
     Atom            COMPOUND_STRING;
     Atom            ATOM_PAIR;
+    Atom            INCR;
     Atom            GLFW_SELECTION;
 
     struct {
@@ -197,6 +233,12 @@ typedef struct _GLFWlibraryX11
         Window      source;
     } xdnd;
 
+    // Direct-mapped cache in front of the XContext window lookup
+    struct {
+        Window       handle;
+        _GLFWwindow* window;
+    } windowCache[_GLFW_X11_WINDOW_CACHE_SIZE];
+
     struct {
         GLboolean   available;
         int         major;
@@ -211,6 +253,8 @@ typedef struct _GLFWlibraryX11
         int         errorBase;
         int         major;
         int         minor;
+        // True if disabled cursor motion is read from XI_RawMotion
+        GLboolean   rawMotion;
     } xi;
 #endif /*_GLFW_HAS_XINPUT*/
 
@@ -249,6 +293,42 @@ typedef struct _GLFWcursorX11
 } _GLFWcursorX11;
 
 
+// X11-specific clipboard contents, shared by the selection and any incremental
+// transfers still sending them
+//
+typedef struct _GLFWselectionX11
+{
+    void*           data;
+    size_t          size;
+    // Called with the data when the last reference is released, if any
+    GLFWclipboardfreefun freefun;
+    // The data targets the contents can be converted to
+    Atom*           targets;
+    int             targetCount;
+    // True if the data is a null-terminated UTF-8 string
+    GLboolean       text;
+    int             refCount;
+
+} _GLFWselectionX11;
+
+
+// X11-specific incremental (INCR) selection transfer
+//
+typedef struct _GLFWtransferX11
+{
+    Window          requestor;
+    Atom            property;
+    Atom            target;
+    // The contents being sent and the offset of the data still to be sent
+    _GLFWselectionX11* selection;
+    size_t          offset;
+    // The time on the GLFW timer when the transfer is abandoned
+    double          deadline;
+    struct _GLFWtransferX11* next;
+
+} _GLFWtransferX11;
+
+
 GLboolean _glfwSetVideoMode(_GLFWmonitor* monitor, const GLFWvidmode* desired);
 void _glfwRestoreVideoMode(_GLFWmonitor* monitor);
 
@@ -259,6 +339,8 @@ unsigned long _glfwGetWindowProperty(Window window,
                                      Atom type,
                                      unsigned char** value);
 
+void _glfwReleaseSelection(_GLFWselectionX11* selection);
+
 void _glfwGrabXErrorHandler(void);
 void _glfwReleaseXErrorHandler(void);
 void _glfwInputXError(int error, const char* message);
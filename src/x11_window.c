@@ -164,6 +164,10 @@ static int translateKey(int scancode)
 static _GLFWwindow* findWindowByHandle(Window handle)
 {
     _GLFWwindow* window;
+    const unsigned int slot = handle & (_GLFW_X11_WINDOW_CACHE_SIZE - 1);
+
+    if (_glfw.x11.windowCache[slot].handle == handle)
+        return _glfw.x11.windowCache[slot].window;
 
     if (XFindContext(_glfw.x11.display,
                      handle,
@@ -173,9 +177,71 @@ static _GLFWwindow* findWindowByHandle(Window handle)
         return NULL;
     }
 
+    _glfw.x11.windowCache[slot].handle = handle;
+    _glfw.x11.windowCache[slot].window = window;
     return window;
 }
 
+// Removes the specified X11 window from the window lookup cache
+//
+static void forgetWindowHandle(Window handle)
+{
+    const unsigned int slot = handle & (_GLFW_X11_WINDOW_CACHE_SIZE - 1);
+
+    if (_glfw.x11.windowCache[slot].handle == handle)
+    {
+        _glfw.x11.windowCache[slot].handle = None;
+        _glfw.x11.windowCache[slot].window = NULL;
+    }
+}
+
+// Returns whether the specified event needs to be passed to the input method
+//
+static GLboolean needsFiltering(const XEvent* event)
+{
+    if (!_glfw.x11.im)
+        return GL_FALSE;
+
+    // Pointer motion makes up most of the event stream and input methods
+    // rarely ask for it, so only filter it if one of the contexts did
+    if (event->type == MotionNotify)
+    {
+        return (_glfw.x11.imFilterMask &
+                (PointerMotionMask | ButtonMotionMask)) != 0;
+    }
+
+    // Input methods predate XInput2 and cannot select its events
+    if (event->type == GenericEvent)
+        return GL_FALSE;
+
+    return GL_TRUE;
+}
+
+// Returns the time of the specified event on the GLFW timer, or zero if it has
+// no usable timestamp
+//
+static double getEventTime(const XEvent* event)
+{
+    switch (event->type)
+    {
+        case KeyPress:
+        case KeyRelease:
+            return _glfwConvertMillisecondTimestamp(event->xkey.time);
+        case ButtonPress:
+        case ButtonRelease:
+            return _glfwConvertMillisecondTimestamp(event->xbutton.time);
+        case MotionNotify:
+            return _glfwConvertMillisecondTimestamp(event->xmotion.time);
+        case EnterNotify:
+        case LeaveNotify:
+            return _glfwConvertMillisecondTimestamp(event->xcrossing.time);
+        case PropertyNotify:
+            return _glfwConvertMillisecondTimestamp(event->xproperty.time);
+        default:
+            return 0.0;
+    }
+}
+
 // Sends an EWMH or ICCCM event to the window manager
 //
 static void sendEventToWM(_GLFWwindow* window, Atom type,
@@ -483,6 +549,18 @@ static GLboolean createWindow(_GLFWwindow* window,
                                    XNFocusWindow,
                                    window->x11.handle,
                                    NULL);
+
+        if (window->x11.ic)
+        {
+            unsigned long filter = 0;
+
+            if (XGetICValues(window->x11.ic,
+                             XNFilterEvents, &filter,
+                             NULL) == NULL)
+            {
+                _glfw.x11.imFilterMask |= filter;
+            }
+        }
     }
 
     _glfwPlatformGetWindowPos(window, &window->x11.xpos, &window->x11.ypos);
@@ -491,10 +569,90 @@ static GLboolean createWindow(_GLFWwindow* window,
     return GL_TRUE;
 }
 
+#if defined(_GLFW_HAS_XINPUT)
+
+// Returns whether all pointer devices report relative motion
+//
+static GLboolean hasRelativePointers(void)
+{
+    int i, j, count;
+    GLboolean result = GL_TRUE;
+    XIDeviceInfo* devices;
+
+    devices = XIQueryDevice(_glfw.x11.display, XIAllDevices, &count);
+    if (!devices)
+        return GL_FALSE;
+
+    for (i = 0;  i < count;  i++)
+    {
+        if (devices[i].use != XISlavePointer || !devices[i].enabled)
+            continue;
+
+        for (j = 0;  j < devices[i].num_classes;  j++)
+        {
+            const XIValuatorClassInfo* valuator =
+                (const XIValuatorClassInfo*) devices[i].classes[j];
+
+            if (valuator->type != XIValuatorClass)
+                continue;
+
+            // Raw values of absolute devices are positions and not deltas
+            if (valuator->number <= 1 && valuator->mode != XIModeRelative)
+                result = GL_FALSE;
+        }
+    }
+
+    XIFreeDeviceInfo(devices);
+    return result;
+}
+
+// Selects or deselects raw pointer motion on the root window
+//
+static void selectRawMotion(GLboolean enabled)
+{
+    XIEventMask eventmask;
+    unsigned char mask[XIMaskLen(XI_RawMotion)] = { 0 };
+
+    eventmask.deviceid = XIAllMasterDevices;
+    eventmask.mask_len = sizeof(mask);
+    eventmask.mask = mask;
+
+    if (enabled)
+        XISetMask(mask, XI_RawMotion);
+
+    XISelectEvents(_glfw.x11.display, _glfw.x11.root, &eventmask, 1);
+    _glfw.x11.xi.rawMotion = enabled;
+}
+
+#endif /*_GLFW_HAS_XINPUT*/
+
+// Stops reading disabled cursor motion from XI_RawMotion
+//
+static void releaseRawMotion(void)
+{
+#if defined(_GLFW_HAS_XINPUT)
+    if (_glfw.x11.xi.rawMotion)
+        selectRawMotion(GL_FALSE);
+#endif /*_GLFW_HAS_XINPUT*/
+}
+
+// Returns whether disabled cursor motion is read from XI_RawMotion
+//
+static GLboolean usingRawMotion(void)
+{
+#if defined(_GLFW_HAS_XINPUT)
+    return _glfw.x11.xi.rawMotion;
+#else
+    return GL_FALSE;
+#endif /*_GLFW_HAS_XINPUT*/
+}
+
 // Hide the mouse cursor
 //
 static void hideCursor(_GLFWwindow* window)
 {
+    releaseRawMotion();
+
     XUngrabPointer(_glfw.x11.display, CurrentTime);
     XDefineCursor(_glfw.x11.display, window->x11.handle, _glfw.x11.cursor);
 }
@@ -507,12 +665,24 @@ static void disableCursor(_GLFWwindow* window)
                  ButtonPressMask | ButtonReleaseMask | PointerMotionMask,
                  GrabModeAsync, GrabModeAsync,
                  window->x11.handle, _glfw.x11.cursor, CurrentTime);
+
+#if defined(_GLFW_HAS_XINPUT)
+    // Unaccelerated deltas are read from raw motion events, which makes
+    // re-centering the confined cursor unnecessary
+    if (_glfw.x11.xi.available && !_glfw.x11.xi.rawMotion &&
+        hasRelativePointers())
+    {
+        selectRawMotion(GL_TRUE);
+    }
+#endif /*_GLFW_HAS_XINPUT*/
 }
 
 // Restores the mouse cursor
 //
 static void restoreCursor(_GLFWwindow* window)
 {
+    releaseRawMotion();
+
     XUngrabPointer(_glfw.x11.display, CurrentTime);
 
     if (window->cursor)
@@ -524,24 +694,280 @@ static void restoreCursor(_GLFWwindow* window)
         XUndefineCursor(_glfw.x11.display, window->x11.handle);
 }
 
+// Returns whether the selection contents can be converted to the target
+//
+static GLboolean hasSelectionTarget(const _GLFWselectionX11* selection, Atom target)
+{
+    int i;
+
+    for (i = 0;  i < selection->targetCount;  i++)
+    {
+        if (selection->targets[i] == target)
+            return GL_TRUE;
+    }
+
+    return GL_FALSE;
+}
+
+// Creates selection contents that take ownership of the data and targets
+//
+static _GLFWselectionX11* createSelection(void* data, size_t size,
+                                          GLFWclipboardfreefun freefun,
+                                          Atom* targets, int targetCount)
+{
+    _GLFWselectionX11* selection = calloc(1, sizeof(_GLFWselectionX11));
+    if (!selection)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+
+        if (freefun)
+            freefun(data);
+
+        free(targets);
+        return NULL;
+    }
+
+    selection->data = data;
+    selection->size = size;
+    selection->freefun = freefun;
+    selection->targets = targets;
+    selection->targetCount = targetCount;
+    selection->refCount = 1;
+
+    return selection;
+}
+
+// Makes the specified selection contents the clipboard of this process
+//
+static void setSelection(_GLFWwindow* window, _GLFWselectionX11* selection)
+{
+    _glfwReleaseSelection(_glfw.x11.selection);
+    _glfw.x11.selection = selection;
+
+    if (!selection)
+        return;
+
+    XSetSelectionOwner(_glfw.x11.display,
+                       _glfw.x11.CLIPBOARD,
+                       window->x11.handle, CurrentTime);
+
+    if (XGetSelectionOwner(_glfw.x11.display, _glfw.x11.CLIPBOARD) !=
+        window->x11.handle)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "X11: Failed to become owner of clipboard selection");
+
+        _glfwReleaseSelection(_glfw.x11.selection);
+        _glfw.x11.selection = NULL;
+    }
+}
+
+// Returns the incremental transfer to the specified property, if any
+//
+static _GLFWtransferX11* findTransfer(Window requestor, Atom property)
+{
+    _GLFWtransferX11* transfer;
+
+    for (transfer = _glfw.x11.transferListHead;  transfer;  transfer = transfer->next)
+    {
+        if (transfer->requestor == requestor && transfer->property == property)
+            return transfer;
+    }
+
+    return NULL;
+}
+
 // Returns whether the event is a selection event
 //
 static Bool isSelectionEvent(Display* display, XEvent* event, XPointer pointer)
 {
+    if (event->type == PropertyNotify)
+    {
+        // Property deletions drive the incremental transfers we are sending
+        return event->xproperty.state == PropertyDelete &&
+               findTransfer(event->xproperty.window, event->xproperty.atom);
+    }
+
     return event->type == SelectionRequest ||
            event->type == SelectionNotify ||
            event->type == SelectionClear;
 }
 
+// Starts an incremental transfer of the clipboard to the specified property,
+// for contents too large to send in a single request
+//
+static GLboolean startTransfer(Window requestor, Atom property, Atom target)
+{
+    _GLFWtransferX11* transfer;
+    // The value of INCR is a lower bound on the size of the data
+    const long size = (long) _glfw.x11.selection->size;
+
+    // Allocate before touching the requestor so that a failure leaves its
+    // property unchanged and the request is simply refused
+    transfer = calloc(1, sizeof(_GLFWtransferX11));
+    if (!transfer)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return GL_FALSE;
+    }
+
+    // The requestor deleting the property asks for the next chunk, so we need
+    // to see its property changes, but it may already have been destroyed
+    _glfwGrabXErrorHandler();
+
+    XSelectInput(_glfw.x11.display, requestor, PropertyChangeMask);
+    XChangeProperty(_glfw.x11.display,
+                    requestor,
+                    property,
+                    _glfw.x11.INCR,
+                    32,
+                    PropModeReplace,
+                    (unsigned char*) &size,
+                    1);
+
+    _glfwReleaseXErrorHandler();
+
+    if (_glfw.x11.errorCode != Success)
+    {
+        free(transfer);
+        return GL_FALSE;
+    }
+
+    transfer->requestor = requestor;
+    transfer->property = property;
+    transfer->target = target;
+
+    // The transfer keeps the contents alive if the clipboard changes before
+    // it completes
+    transfer->selection = _glfw.x11.selection;
+    transfer->selection->refCount++;
+
+    if (_glfw.clipboardTimeout)
+        transfer->deadline = _glfwPlatformGetTime() + _glfw.clipboardTimeout;
+
+    transfer->next = _glfw.x11.transferListHead;
+    _glfw.x11.transferListHead = transfer;
+
+    return GL_TRUE;
+}
+
+// Removes the specified incremental transfer
+//
+static void endTransfer(_GLFWtransferX11* transfer)
+{
+    _GLFWtransferX11* other;
+    _GLFWtransferX11** prev = &_glfw.x11.transferListHead;
+
+    while (*prev != transfer)
+        prev = &((*prev)->next);
+
+    *prev = transfer->next;
+
+    // Stop listening to the requestor once no other transfer is using it
+    for (other = _glfw.x11.transferListHead;  other;  other = other->next)
+    {
+        if (other->requestor == transfer->requestor)
+            break;
+    }
+
+    if (!other)
+    {
+        // The requestor may have been destroyed, which is why transfers end
+        _glfwGrabXErrorHandler();
+        XSelectInput(_glfw.x11.display, transfer->requestor, NoEventMask);
+        _glfwReleaseXErrorHandler();
+    }
+
+    _glfwReleaseSelection(transfer->selection);
+    free(transfer);
+}
+
+// Sends the next chunk of the incremental transfer to the property, if any
+// Returns whether the property was the target of an incremental transfer
+//
+static GLboolean handleTransferPropertyNotify(const XPropertyEvent* event)
+{
+    size_t size;
+    _GLFWtransferX11* transfer;
+
+    if (event->state != PropertyDelete)
+        return GL_FALSE;
+
+    transfer = findTransfer(event->window, event->atom);
+    if (!transfer)
+        return GL_FALSE;
+
+    // The requestor has deleted the property, asking for the next chunk, and
+    // a zero-length chunk tells it that the transfer is complete
+    size = transfer->selection->size - transfer->offset;
+    if (size > _glfw.x11.selectionChunkSize)
+        size = _glfw.x11.selectionChunkSize;
+
+    XChangeProperty(_glfw.x11.display,
+                    transfer->requestor,
+                    transfer->property,
+                    transfer->target,
+                    8,
+                    PropModeReplace,
+                    (unsigned char*) transfer->selection->data + transfer->offset,
+                    (int) size);
+
+    if (size)
+    {
+        transfer->offset += size;
+
+        if (transfer->deadline)
+            transfer->deadline = _glfwPlatformGetTime() + _glfw.clipboardTimeout;
+    }
+    else
+        endTransfer(transfer);
+
+    XFlush(_glfw.x11.display);
+    return GL_TRUE;
+}
+
+// Abandons any incremental transfer whose requestor has stopped responding
+//
+static void checkTransferTimeouts(void)
+{
+    _GLFWtransferX11* transfer = _glfw.x11.transferListHead;
+
+    while (transfer)
+    {
+        _GLFWtransferX11* next = transfer->next;
+
+        if (transfer->deadline && _glfwPlatformGetTime() >= transfer->deadline)
+            endTransfer(transfer);
+
+        transfer = next;
+    }
+}
+
+// Writes the clipboard contents to the specified property, incrementally if
+// they are too large to send in a single request
+//
+static GLboolean writeSelection(Window requestor, Atom property, Atom target)
+{
+    if (_glfw.x11.selection->size > _glfw.x11.selectionChunkSize)
+        return startTransfer(requestor, property, target);
+
+    XChangeProperty(_glfw.x11.display,
+                    requestor,
+                    property,
+                    target,
+                    8,
+                    PropModeReplace,
+                    (unsigned char*) _glfw.x11.selection->data,
+                    (int) _glfw.x11.selection->size);
+
+    return GL_TRUE;
+}
+
 // Set the specified property to the selection converted to the requested target
 //
 static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
 {
-    int i;
-    const Atom formats[] = { _glfw.x11.UTF8_STRING,
-                             _glfw.x11.COMPOUND_STRING,
-                             XA_STRING };
-    const int formatCount = sizeof(formats) / sizeof(formats[0]);
+    const _GLFWselectionX11* selection = _glfw.x11.selection;
 
     if (request->property == None)
     {
@@ -550,15 +976,29 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
         return None;
     }
 
+    if (!selection)
+    {
+        // We lost the selection before this request was processed
+        return None;
+    }
+
     if (request->target == _glfw.x11.TARGETS)
     {
         // The list of supported targets was requested
 
-        const Atom targets[] = { _glfw.x11.TARGETS,
-                                 _glfw.x11.MULTIPLE,
-                                 _glfw.x11.UTF8_STRING,
-                                 _glfw.x11.COMPOUND_STRING,
-                                 XA_STRING };
+        int i, count = 0;
+        Atom* targets = calloc(selection->targetCount + 2, sizeof(Atom));
+        if (!targets)
+        {
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            return None;
+        }
+
+        targets[count++] = _glfw.x11.TARGETS;
+        targets[count++] = _glfw.x11.MULTIPLE;
+
+        for (i = 0;  i < selection->targetCount;  i++)
+            targets[count++] = selection->targets[i];
 
         XChangeProperty(_glfw.x11.display,
                         request->requestor,
@@ -567,8 +1007,9 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
                         32,
                         PropModeReplace,
                         (unsigned char*) targets,
-                        sizeof(targets) / sizeof(targets[0]));
+                        count);
 
+        free(targets);
         return request->property;
     }
 
@@ -586,27 +1027,11 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
 
         for (i = 0;  i < count;  i += 2)
         {
-            int j;
-
-            for (j = 0;  j < formatCount;  j++)
-            {
-                if (targets[i] == formats[j])
-                    break;
-            }
-
-            if (j < formatCount)
+            if (!hasSelectionTarget(selection, targets[i]) ||
+                !writeSelection(request->requestor, targets[i + 1], targets[i]))
             {
-                XChangeProperty(_glfw.x11.display,
-                                request->requestor,
-                                targets[i + 1],
-                                targets[i],
-                                8,
-                                PropModeReplace,
-                                (unsigned char*) _glfw.x11.clipboardString,
-                                strlen(_glfw.x11.clipboardString));
-            }
-            else
                 targets[i + 1] = None;
+            }
         }
 
         XChangeProperty(_glfw.x11.display,
@@ -620,119 +1045,489 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
 
         XFree(targets);
 
-        return request->property;
+        return request->property;
+    }
+
+    if (request->target == _glfw.x11.SAVE_TARGETS)
+    {
+        // The request is a check whether we support SAVE_TARGETS
+        // It should be handled as a no-op side effect target
+
+        XChangeProperty(_glfw.x11.display,
+                        request->requestor,
+                        request->property,
+                        _glfw.x11.NULL_,
+                        32,
+                        PropModeReplace,
+                        NULL,
+                        0);
+
+        return request->property;
+    }
+
+    // Conversion to a data target was requested
+
+    if (hasSelectionTarget(selection, request->target))
+    {
+        // The requested target is one we support
+
+        if (!writeSelection(request->requestor,
+                            request->property,
+                            request->target))
+        {
+            return None;
+        }
+
+        return request->property;
+    }
+
+    // The requested target is not supported
+
+    return None;
+}
+
+static void handleSelectionClear(XEvent* event)
+{
+    // Any incremental transfers still in progress keep their own reference
+    _glfwReleaseSelection(_glfw.x11.selection);
+    _glfw.x11.selection = NULL;
+}
+
+static void handleSelectionRequest(XEvent* event)
+{
+    const XSelectionRequestEvent* request = &event->xselectionrequest;
+
+    XEvent reply;
+    memset(&reply, 0, sizeof(reply));
+
+    reply.xselection.property = writeTargetToProperty(request);
+    reply.xselection.type = SelectionNotify;
+    reply.xselection.display = request->display;
+    reply.xselection.requestor = request->requestor;
+    reply.xselection.selection = request->selection;
+    reply.xselection.target = request->target;
+    reply.xselection.time = request->time;
+
+    XSendEvent(_glfw.x11.display, request->requestor, False, 0, &reply);
+}
+
+static void pushSelectionToManager(_GLFWwindow* window)
+{
+    XConvertSelection(_glfw.x11.display,
+                      _glfw.x11.CLIPBOARD_MANAGER,
+                      _glfw.x11.SAVE_TARGETS,
+                      None,
+                      window->x11.handle,
+                      CurrentTime);
+
+    for (;;)
+    {
+        XEvent event;
+
+        while (XCheckIfEvent(_glfw.x11.display, &event, isSelectionEvent, NULL))
+        {
+            switch (event.type)
+            {
+                case SelectionRequest:
+                    handleSelectionRequest(&event);
+                    break;
+
+                case SelectionClear:
+                    handleSelectionClear(&event);
+                    break;
+
+                case PropertyNotify:
+                    handleTransferPropertyNotify(&event.xproperty);
+                    break;
+
+                case SelectionNotify:
+                {
+                    if (event.xselection.target == _glfw.x11.SAVE_TARGETS)
+                    {
+                        // This means one of two things; either the selection was
+                        // not owned, which means there is no clipboard manager, or
+                        // the transfer to the clipboard manager has completed
+                        // In either case, it means we are done here
+                        return;
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        selectDisplayConnection(NULL);
+    }
+}
+
+// Returns the string target after the specified one in order of preference,
+// or the most preferred one if None is specified
+//
+static Atom nextStringTarget(Atom previous)
+{
+    if (previous == None)
+        return _glfw.x11.UTF8_STRING;
+    if (previous == _glfw.x11.UTF8_STRING)
+        return _glfw.x11.COMPOUND_STRING;
+    if (previous == _glfw.x11.COMPOUND_STRING)
+        return XA_STRING;
+
+    return None;
+}
+
+// Returns the most preferred string target in the specified list, or None
+//
+static Atom chooseStringTarget(const Atom* targets, unsigned long count)
+{
+    Atom target;
+
+    for (target = nextStringTarget(None);  target;  target = nextStringTarget(target))
+    {
+        unsigned long i;
+
+        for (i = 0;  i < count;  i++)
+        {
+            if (targets[i] == target)
+                return target;
+        }
+    }
+
+    return None;
+}
+
+// Asks the clipboard owner to convert the clipboard to the specified target
+//
+static void convertClipboard(_GLFWwindow* window, Atom target)
+{
+    window->x11.clipboard.target = target;
+
+    XConvertSelection(_glfw.x11.display,
+                      _glfw.x11.CLIPBOARD,
+                      target,
+                      _glfw.x11.GLFW_SELECTION,
+                      window->x11.handle, CurrentTime);
+    XFlush(_glfw.x11.display);
+}
+
+// Completes the pending clipboard request of the specified window
+//
+static void completeClipboardRequest(_GLFWwindow* window, const char* string)
+{
+    window->x11.clipboard.target = None;
+    window->x11.clipboard.incr = GL_FALSE;
+
+    if (window->x11.clipboard.async)
+        _glfwInputClipboardString(window, string);
+    else
+    {
+        free(_glfw.x11.clipboardString);
+
+        if (string == window->x11.clipboard.data)
+        {
+            // Keep the incrementally received data instead of copying it
+            _glfw.x11.clipboardString = window->x11.clipboard.data;
+            window->x11.clipboard.data = NULL;
+        }
+        else
+            _glfw.x11.clipboardString = string ? strdup(string) : NULL;
+    }
+
+    free(window->x11.clipboard.data);
+    window->x11.clipboard.data = NULL;
+}
+
+// Sets the deadline of the clipboard request of the specified window
+//
+static void resetClipboardDeadline(_GLFWwindow* window)
+{
+    if (_glfw.clipboardTimeout)
+        window->x11.clipboard.deadline = _glfwPlatformGetTime() + _glfw.clipboardTimeout;
+    else
+        window->x11.clipboard.deadline = 0.0;
+}
+
+// Reads and deletes the specified selection property of the specified window
+// Returns the number of items in the property
+//
+static unsigned long readSelectionProperty(Window handle,
+                                           Atom property,
+                                           Atom* type,
+                                           unsigned char** data)
+{
+    int format;
+    unsigned long count, bytesAfter;
+
+    *type = None;
+    *data = NULL;
+
+    if (XGetWindowProperty(_glfw.x11.display,
+                           handle,
+                           property,
+                           0,
+                           LONG_MAX,
+                           True,
+                           AnyPropertyType,
+                           type,
+                           &format,
+                           &count,
+                           &bytesAfter,
+                           data) != Success)
+    {
+        return 0;
+    }
+
+    return count;
+}
+
+// Starts a clipboard request for the specified window
+// The request is completed immediately if no conversion is needed
+//
+static void startClipboardRequest(_GLFWwindow* window, GLboolean async)
+{
+    const Window owner = XGetSelectionOwner(_glfw.x11.display,
+                                            _glfw.x11.CLIPBOARD);
+
+    window->x11.clipboard.async = async;
+    window->x11.clipboard.fallback = GL_FALSE;
+
+    if (_glfw.x11.selection && findWindowByHandle(owner))
+    {
+        // Instead of doing a large number of X round-trips just to put this
+        // string into a window property and then read it back, just return it
+        if (_glfw.x11.selection->text)
+            completeClipboardRequest(window, _glfw.x11.selection->data);
+        else
+        {
+            _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                            "X11: The clipboard does not contain a string");
+            completeClipboardRequest(window, NULL);
+        }
+
+        return;
+    }
+
+    if (owner == None)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE, "X11: The clipboard is empty");
+        completeClipboardRequest(window, NULL);
+        return;
+    }
+
+    resetClipboardDeadline(window);
+
+    // Asking for the supported targets first lets the best string target be
+    // requested directly instead of trying each in turn
+    convertClipboard(window, _glfw.x11.TARGETS);
+}
+
+// Handles a reply from the clipboard owner to a conversion request
+//
+static void handleClipboardNotify(_GLFWwindow* window, const XSelectionEvent* event)
+{
+    const Atom target = window->x11.clipboard.target;
+    Atom type = None;
+    unsigned char* data = NULL;
+    unsigned long count = 0;
+
+    if (event->property != None)
+    {
+        count = readSelectionProperty(event->requestor,
+                                      event->property,
+                                      &type,
+                                      &data);
+    }
+
+    if (target == None || event->target != target || window->x11.clipboard.incr)
+    {
+        // This is the late reply to a request that has already completed
+        XFree(data);
+        return;
+    }
+
+    if (target == _glfw.x11.TARGETS)
+    {
+        Atom next;
+
+        if (count && type == XA_ATOM)
+            next = chooseStringTarget((Atom*) data, count);
+        else
+        {
+            // The owner does not report its targets, so try each in turn
+            window->x11.clipboard.fallback = GL_TRUE;
+            next = nextStringTarget(None);
+        }
+
+        XFree(data);
+
+        if (next)
+            convertClipboard(window, next);
+        else
+        {
+            _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                            "X11: Failed to convert clipboard to string");
+            completeClipboardRequest(window, NULL);
+        }
+
+        return;
     }
 
-    if (request->target == _glfw.x11.SAVE_TARGETS)
+    if (count && type == _glfw.x11.INCR)
     {
-        // The request is a check whether we support SAVE_TARGETS
-        // It should be handled as a no-op side effect target
+        // The data is too large for a single request and will arrive as
+        // a series of property changes, the first of which was requested
+        // by reading and deleting the property above
+        // The announced size is an untrusted 32-bit lower bound, so it is
+        // only used as a hint for the initial allocation
+        size_t size = (size_t) (((unsigned long*) data)[0] & 0xffffffffUL);
 
-        XChangeProperty(_glfw.x11.display,
-                        request->requestor,
-                        request->property,
-                        _glfw.x11.NULL_,
-                        32,
-                        PropModeReplace,
-                        NULL,
-                        0);
+        XFree(data);
 
-        return request->property;
-    }
+        if (size > _glfw.x11.selectionChunkSize * 4)
+            size = _glfw.x11.selectionChunkSize * 4;
 
-    // Conversion to a data target was requested
+        window->x11.clipboard.incr = GL_TRUE;
+        window->x11.clipboard.length = 0;
+        window->x11.clipboard.capacity = size + 1;
+        window->x11.clipboard.data = malloc(window->x11.clipboard.capacity);
 
-    for (i = 0;  i < formatCount;  i++)
-    {
-        if (request->target == formats[i])
+        if (!window->x11.clipboard.data)
         {
-            // The requested target is one we support
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            completeClipboardRequest(window, NULL);
+            return;
+        }
 
-            XChangeProperty(_glfw.x11.display,
-                            request->requestor,
-                            request->property,
-                            request->target,
-                            8,
-                            PropModeReplace,
-                            (unsigned char*) _glfw.x11.clipboardString,
-                            strlen(_glfw.x11.clipboardString));
+        resetClipboardDeadline(window);
+        return;
+    }
 
-            return request->property;
-        }
+    if (count && type == target)
+    {
+        // Property data is always null-terminated by Xlib
+        completeClipboardRequest(window, (const char*) data);
+        XFree(data);
+        return;
     }
 
-    // The requested target is not supported
+    XFree(data);
 
-    return None;
-}
+    if (window->x11.clipboard.fallback && nextStringTarget(target))
+    {
+        convertClipboard(window, nextStringTarget(target));
+        return;
+    }
 
-static void handleSelectionClear(XEvent* event)
-{
-    free(_glfw.x11.clipboardString);
-    _glfw.x11.clipboardString = NULL;
+    _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                    "X11: Failed to convert clipboard to string");
+    completeClipboardRequest(window, NULL);
 }
 
-static void handleSelectionRequest(XEvent* event)
+// Appends the next chunk of an incremental clipboard transfer, completing the
+// request when the last chunk has arrived
+//
+static void handleClipboardChunk(_GLFWwindow* window, const XPropertyEvent* event)
 {
-    const XSelectionRequestEvent* request = &event->xselectionrequest;
+    Atom type;
+    unsigned char* data;
+    unsigned long count;
 
-    XEvent reply;
-    memset(&reply, 0, sizeof(reply));
+    if (!window->x11.clipboard.incr ||
+        event->atom != _glfw.x11.GLFW_SELECTION ||
+        event->state != PropertyNewValue)
+    {
+        return;
+    }
 
-    reply.xselection.property = writeTargetToProperty(request);
-    reply.xselection.type = SelectionNotify;
-    reply.xselection.display = request->display;
-    reply.xselection.requestor = request->requestor;
-    reply.xselection.selection = request->selection;
-    reply.xselection.target = request->target;
-    reply.xselection.time = request->time;
+    // Deleting the property asks the owner for the next chunk
+    count = readSelectionProperty(window->x11.handle,
+                                  _glfw.x11.GLFW_SELECTION,
+                                  &type,
+                                  &data);
 
-    XSendEvent(_glfw.x11.display, request->requestor, False, 0, &reply);
-}
+    if (!count)
+    {
+        // A zero-length chunk ends the transfer
+        XFree(data);
+        window->x11.clipboard.data[window->x11.clipboard.length] = '\0';
+        completeClipboardRequest(window, window->x11.clipboard.data);
+        return;
+    }
 
-static void pushSelectionToManager(_GLFWwindow* window)
-{
-    XConvertSelection(_glfw.x11.display,
-                      _glfw.x11.CLIPBOARD_MANAGER,
-                      _glfw.x11.SAVE_TARGETS,
-                      None,
-                      window->x11.handle,
-                      CurrentTime);
+    if (type != window->x11.clipboard.target)
+    {
+        XFree(data);
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "X11: Failed to convert clipboard to string");
+        completeClipboardRequest(window, NULL);
+        return;
+    }
 
-    for (;;)
+    if (window->x11.clipboard.length + count >= window->x11.clipboard.capacity)
     {
-        XEvent event;
+        // The announced size is only a lower bound
+        char* grown = NULL;
+        size_t capacity = window->x11.clipboard.capacity;
 
-        while (XCheckIfEvent(_glfw.x11.display, &event, isSelectionEvent, NULL))
+        while (capacity <= SIZE_MAX / 2 &&
+               window->x11.clipboard.length + count >= capacity)
         {
-            switch (event.type)
-            {
-                case SelectionRequest:
-                    handleSelectionRequest(&event);
-                    break;
-
-                case SelectionClear:
-                    handleSelectionClear(&event);
-                    break;
+            capacity *= 2;
+        }
 
-                case SelectionNotify:
-                {
-                    if (event.xselection.target == _glfw.x11.SAVE_TARGETS)
-                    {
-                        // This means one of two things; either the selection was
-                        // not owned, which means there is no clipboard manager, or
-                        // the transfer to the clipboard manager has completed
-                        // In either case, it means we are done here
-                        return;
-                    }
+        if (window->x11.clipboard.length + count < capacity)
+            grown = realloc(window->x11.clipboard.data, capacity);
 
-                    break;
-                }
-            }
+        if (!grown)
+        {
+            XFree(data);
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            completeClipboardRequest(window, NULL);
+            return;
         }
 
-        selectDisplayConnection(NULL);
+        window->x11.clipboard.data = grown;
+        window->x11.clipboard.capacity = capacity;
+    }
+
+    memcpy(window->x11.clipboard.data + window->x11.clipboard.length, data, count);
+    window->x11.clipboard.length += count;
+    XFree(data);
+
+    // The deadline applies to each chunk, not to the whole transfer
+    resetClipboardDeadline(window);
+}
+
+// Returns whether the event is part of the clipboard request of the window
+//
+static Bool isClipboardEvent(Display* display, XEvent* event, XPointer pointer)
+{
+    _GLFWwindow* window = (_GLFWwindow*) pointer;
+
+    if (event->xany.window != window->x11.handle)
+        return False;
+
+    if (event->type == PropertyNotify)
+    {
+        return event->xproperty.atom == _glfw.x11.GLFW_SELECTION &&
+               event->xproperty.state == PropertyNewValue;
     }
+
+    return event->type == SelectionNotify;
+}
+
+// Abandons the clipboard request of the specified window if it has timed out
+//
+static void checkClipboardTimeout(_GLFWwindow* window)
+{
+    if (window->x11.clipboard.target == None || !window->x11.clipboard.deadline)
+        return;
+
+    if (_glfwPlatformGetTime() < window->x11.clipboard.deadline)
+        return;
+
+    _glfwInputError(GLFW_PLATFORM_ERROR,
+                    "X11: The clipboard owner did not respond in time");
+    completeClipboardRequest(window, NULL);
 }
 
 // Enter full screen mode
@@ -865,9 +1660,19 @@ static void processEvent(XEvent *event)
     _GLFWwindow* window = NULL;
     Bool filtered = False;
 
-    if (_glfw.x11.im)
+    if (needsFiltering(event))
         filtered = XFilterEvent(event, None);
 
+    _glfwInputEventTime(getEventTime(event));
+
+    if (event->type == PropertyNotify)
+    {
+        // Incremental transfers are driven by the requestor, which is usually
+        // a window of another client
+        if (handleTransferPropertyNotify(&event->xproperty))
+            return;
+    }
+
     if (event->type != GenericEvent)
     {
         window = findWindowByHandle(event->xany.window);
@@ -1041,12 +1846,19 @@ static void processEvent(XEvent *event)
             if (window->cursorMode == GLFW_CURSOR_HIDDEN)
                 hideCursor(window);
 
+            window->x11.cursorPosX = event->xcrossing.x;
+            window->x11.cursorPosY = event->xcrossing.y;
+            window->x11.cursorPosValid = GL_TRUE;
+
             _glfwInputCursorEnter(window, GL_TRUE);
             break;
         }
 
         case LeaveNotify:
         {
+            // No motion events are received while the cursor is outside
+            window->x11.cursorPosValid = GL_FALSE;
+
             _glfwInputCursorEnter(window, GL_FALSE);
             break;
         }
@@ -1065,6 +1877,15 @@ static void processEvent(XEvent *event)
                     if (_glfw.focusedWindow != window)
                         break;
 
+                    if (usingRawMotion())
+                    {
+                        // Deltas are reported by XI_RawMotion instead
+                        window->x11.cursorPosX = x;
+                        window->x11.cursorPosY = y;
+                        window->x11.cursorPosValid = GL_TRUE;
+                        break;
+                    }
+
                     _glfwInputCursorMotion(window,
                                            x - window->x11.cursorPosX,
                                            y - window->x11.cursorPosY);
@@ -1075,6 +1896,7 @@ static void processEvent(XEvent *event)
 
             window->x11.cursorPosX = x;
             window->x11.cursorPosY = y;
+            window->x11.cursorPosValid = GL_TRUE;
             break;
         }
 
@@ -1104,6 +1926,9 @@ static void processEvent(XEvent *event)
 
                 window->x11.xpos = event->xconfigure.x;
                 window->x11.ypos = event->xconfigure.y;
+
+                // The cursor position is relative to the window
+                window->x11.cursorPosValid = GL_FALSE;
             }
 
             break;
@@ -1195,6 +2020,12 @@ static void processEvent(XEvent *event)
 
         case SelectionNotify:
         {
+            if (event->xselection.selection == _glfw.x11.CLIPBOARD)
+            {
+                handleClipboardNotify(window, &event->xselection);
+                break;
+            }
+
             if (event->xselection.property)
             {
                 // The converted data from the drag operation has arrived
@@ -1288,6 +2119,8 @@ static void processEvent(XEvent *event)
                 else if (state == NormalState)
                     _glfwInputWindowIconify(window, GL_FALSE);
             }
+            else if (event->xproperty.atom == _glfw.x11.GLFW_SELECTION)
+                handleClipboardChunk(window, &event->xproperty);
 
             break;
         }
@@ -1317,6 +2150,8 @@ static void processEvent(XEvent *event)
                 {
                     XIDeviceEvent* data = (XIDeviceEvent*) event->xcookie.data;
 
+                    _glfwInputEventTime(_glfwConvertMillisecondTimestamp(data->time));
+
                     window = findWindowByHandle(data->event);
                     if (window)
                     {
@@ -1325,27 +2160,50 @@ static void processEvent(XEvent *event)
                         {
                             // The cursor was moved by something other than GLFW
 
-                            double x, y;
-
                             if (window->cursorMode == GLFW_CURSOR_DISABLED)
                             {
-                                if (_glfw.focusedWindow != window)
-                                    break;
-
-                                x = data->event_x - window->x11.cursorPosX;
-                                y = data->event_y - window->x11.cursorPosY;
+                                // Only the focused window reports disabled
+                                // cursor motion, and with raw motion the
+                                // deltas are reported by XI_RawMotion instead
+                                if (_glfw.focusedWindow == window &&
+                                    !_glfw.x11.xi.rawMotion)
+                                {
+                                    _glfwInputCursorMotion(window,
+                                                           data->event_x - window->x11.cursorPosX,
+                                                           data->event_y - window->x11.cursorPosY);
+                                }
                             }
                             else
-                            {
-                                x = data->event_x;
-                                y = data->event_y;
-                            }
-
-                            _glfwInputCursorMotion(window, x, y);
+                                _glfwInputCursorMotion(window, data->event_x, data->event_y);
                         }
 
                         window->x11.cursorPosX = data->event_x;
                         window->x11.cursorPosY = data->event_y;
+                        window->x11.cursorPosValid = GL_TRUE;
+                    }
+                }
+                else if (event->xcookie.evtype == XI_RawMotion)
+                {
+                    XIRawEvent* data = (XIRawEvent*) event->xcookie.data;
+
+                    _glfwInputEventTime(_glfwConvertMillisecondTimestamp(data->time));
+
+                    window = _glfw.focusedWindow;
+                    if (window &&
+                        window->cursorMode == GLFW_CURSOR_DISABLED &&
+                        _glfw.x11.xi.rawMotion)
+                    {
+                        // Values are only present for the valuators that
+                        // changed, in order of valuator number
+                        const double* values = data->raw_values;
+                        double dx = 0.0, dy = 0.0;
+
+                        if (XIMaskIsSet(data->valuators.mask, 0))
+                            dx = *values++;
+                        if (XIMaskIsSet(data->valuators.mask, 1))
+                            dy = *values;
+
+                        _glfwInputCursorMotion(window, dx, dy);
                     }
                 }
             }
@@ -1357,6 +2215,15 @@ static void processEvent(XEvent *event)
 
         default:
         {
+#if defined(_GLFW_GLX)
+            if (event->type == _glfw.glx.eventBase + GLX_BufferSwapComplete)
+            {
+                _glfwInputSwapCompleteGLX(window,
+                                          (GLXBufferSwapComplete*) event);
+                break;
+            }
+#endif
+
             switch (event->type - _glfw.x11.randr.eventBase)
             {
                 case RRScreenChangeNotify:
@@ -1408,6 +2275,25 @@ unsigned long _glfwGetWindowProperty(Window window,
 }
 
 
+// Releases a reference to the specified selection contents, freeing them
+// when it was the last one
+//
+void _glfwReleaseSelection(_GLFWselectionX11* selection)
+{
+    if (!selection)
+        return;
+
+    if (--selection->refCount)
+        return;
+
+    if (selection->freefun)
+        selection->freefun(selection->data);
+
+    free(selection->targets);
+    free(selection);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -1420,6 +2306,10 @@ int _glfwPlatformCreateWindow(_GLFWwindow* window,
     if (!_glfwCreateContext(window, ctxconfig, fbconfig))
         return GL_FALSE;
 
+    // Offscreen windows render to a pbuffer and have no X11 window
+    if (wndconfig->offscreen)
+        return GL_TRUE;
+
     if (!createWindow(window, wndconfig))
         return GL_FALSE;
 
@@ -1453,6 +2343,10 @@ void _glfwPlatformDestroyWindow(_GLFWwindow* window)
             pushSelectionToManager(window);
         }
 
+        free(window->x11.clipboard.data);
+        window->x11.clipboard.data = NULL;
+
+        forgetWindowHandle(window->x11.handle);
         XDeleteContext(_glfw.x11.display, window->x11.handle, _glfw.x11.context);
         XUnmapWindow(_glfw.x11.display, window->x11.handle);
         XDestroyWindow(_glfw.x11.display, window->x11.handle);
@@ -1726,6 +2620,7 @@ int _glfwPlatformWindowVisible(_GLFWwindow* window)
 
 void _glfwPlatformPollEvents(void)
 {
+    _GLFWwindow* window;
     int count = XPending(_glfw.x11.display);
     while (count--)
     {
@@ -1734,8 +2629,17 @@ void _glfwPlatformPollEvents(void)
         processEvent(&event);
     }
 
-    _GLFWwindow* window = _glfw.focusedWindow;
-    if (window && window->cursorMode == GLFW_CURSOR_DISABLED)
+    _glfwPollJoystickEvents();
+    _glfwPollWatchedEvents();
+
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+        checkClipboardTimeout(window);
+
+    checkTransferTimeouts();
+
+    window = _glfw.focusedWindow;
+    if (window && window->cursorMode == GLFW_CURSOR_DISABLED &&
+        !usingRawMotion())
     {
         int width, height;
         _glfwPlatformGetWindowSize(window, &width, &height);
@@ -1745,25 +2649,54 @@ void _glfwPlatformPollEvents(void)
 
 void _glfwPlatformWaitEvents(void)
 {
+    _glfwPlatformWaitEventsTimeout(-1.0);
+}
+
+void _glfwPlatformWaitEventsTimeout(double timeout)
+{
+    _GLFWwindow* window;
+    _GLFWtransferX11* transfer;
+
+    // Wake up in time to abandon any clipboard request that times out
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+    {
+        if (window->x11.clipboard.target && window->x11.clipboard.deadline)
+        {
+            double remaining = window->x11.clipboard.deadline - _glfwPlatformGetTime();
+            if (remaining < 0.0)
+                remaining = 0.0;
+
+            if (timeout < 0.0 || remaining < timeout)
+                timeout = remaining;
+        }
+    }
+
+    // Wake up in time to abandon any transfer whose requestor has gone away,
+    // as it keeps the replaced clipboard contents alive
+    for (transfer = _glfw.x11.transferListHead;  transfer;  transfer = transfer->next)
+    {
+        if (transfer->deadline)
+        {
+            double remaining = transfer->deadline - _glfwPlatformGetTime();
+            if (remaining < 0.0)
+                remaining = 0.0;
+
+            if (timeout < 0.0 || remaining < timeout)
+                timeout = remaining;
+        }
+    }
+
     if (!XPending(_glfw.x11.display))
-        selectDisplayConnection(NULL);
+        _glfwWaitForEvents(timeout);
 
     _glfwPlatformPollEvents();
 }
 
 void _glfwPlatformPostEmptyEvent(void)
 {
-    XEvent event;
-    _GLFWwindow* window = _glfw.windowListHead;
-
-    memset(&event, 0, sizeof(event));
-    event.type = ClientMessage;
-    event.xclient.window = window->x11.handle;
-    event.xclient.format = 32; // Data is 32-bit longs
-    event.xclient.message_type = _glfw.x11.NULL_;
-
-    XSendEvent(_glfw.x11.display, window->x11.handle, False, 0, &event);
-    XFlush(_glfw.x11.display);
+    // The wait is signaled directly instead of with a round trip through the
+    // X server, which also works when there are no windows to send to
+    _glfwSignalWait();
 }
 
 void _glfwPlatformGetCursorPos(_GLFWwindow* window, double* xpos, double* ypos)
@@ -1772,6 +2705,17 @@ void _glfwPlatformGetCursorPos(_GLFWwindow* window, double* xpos, double* ypos)
     int rootX, rootY, childX, childY;
     unsigned int mask;
 
+    if (window->x11.cursorPosValid)
+    {
+        // The position is kept up to date by the event stream
+        if (xpos)
+            *xpos = window->x11.cursorPosX;
+        if (ypos)
+            *ypos = window->x11.cursorPosY;
+
+        return;
+    }
+
     XQueryPointer(_glfw.x11.display, window->x11.handle,
                   &root, &child,
                   &rootX, &rootY, &childX, &childY,
@@ -1789,6 +2733,9 @@ void _glfwPlatformSetCursorPos(_GLFWwindow* window, double x, double y)
     window->x11.warpPosX = (int) x;
     window->x11.warpPosY = (int) y;
 
+    // The warp may not take effect, so wait for its motion event
+    window->x11.cursorPosValid = GL_FALSE;
+
     XWarpPointer(_glfw.x11.display, None, window->x11.handle,
                  0,0,0,0, (int) x, (int) y);
 }
@@ -1855,86 +2802,109 @@ void _glfwPlatformSetCursor(_GLFWwindow* window, _GLFWcursor* cursor)
 
 void _glfwPlatformSetClipboardString(_GLFWwindow* window, const char* string)
 {
-    free(_glfw.x11.clipboardString);
-    _glfw.x11.clipboardString = strdup(string);
+    _GLFWselectionX11* selection;
+    char* copy = strdup(string);
+    Atom* targets = calloc(3, sizeof(Atom));
 
-    XSetSelectionOwner(_glfw.x11.display,
-                       _glfw.x11.CLIPBOARD,
-                       window->x11.handle, CurrentTime);
+    if (!copy || !targets)
+    {
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        free(copy);
+        free(targets);
+        return;
+    }
 
-    if (XGetSelectionOwner(_glfw.x11.display, _glfw.x11.CLIPBOARD) !=
-        window->x11.handle)
+    targets[0] = _glfw.x11.UTF8_STRING;
+    targets[1] = _glfw.x11.COMPOUND_STRING;
+    targets[2] = XA_STRING;
+
+    selection = createSelection(copy, strlen(copy), free, targets, 3);
+    if (selection)
+        selection->text = GL_TRUE;
+
+    setSelection(window, selection);
+}
+
+void _glfwPlatformSetClipboardData(_GLFWwindow* window,
+                                   const char** types, int count,
+                                   void* data, size_t size,
+                                   GLFWclipboardfreefun cbfun)
+{
+    // The MIME types are used directly as selection targets
+    Atom* targets = calloc(count, sizeof(Atom));
+    if (!targets)
     {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "X11: Failed to become owner of clipboard selection");
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+
+        if (cbfun)
+            cbfun(data);
+
+        return;
     }
+
+    XInternAtoms(_glfw.x11.display, (char**) types, count, False, targets);
+
+    setSelection(window, createSelection(data, size, cbfun, targets, count));
 }
 
 const char* _glfwPlatformGetClipboardString(_GLFWwindow* window)
 {
-    size_t i;
-    const Atom formats[] = { _glfw.x11.UTF8_STRING,
-                             _glfw.x11.COMPOUND_STRING,
-                             XA_STRING };
-    const size_t formatCount = sizeof(formats) / sizeof(formats[0]);
-
-    if (findWindowByHandle(XGetSelectionOwner(_glfw.x11.display,
-                                              _glfw.x11.CLIPBOARD)))
+    if (window->x11.clipboard.target && window->x11.clipboard.async)
     {
-        // Instead of doing a large number of X round-trips just to put this
-        // string into a window property and then read it back, just return it
-        return _glfw.x11.clipboardString;
+        // The pending request would receive the replies meant for this one
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "X11: A clipboard request is already pending");
+        return NULL;
     }
 
-    free(_glfw.x11.clipboardString);
-    _glfw.x11.clipboardString = NULL;
+    startClipboardRequest(window, GL_FALSE);
 
-    for (i = 0;  i < formatCount;  i++)
+    while (window->x11.clipboard.target)
     {
-        char* data;
         XEvent event;
 
-        XConvertSelection(_glfw.x11.display,
-                          _glfw.x11.CLIPBOARD,
-                          formats[i],
-                          _glfw.x11.GLFW_SELECTION,
-                          window->x11.handle, CurrentTime);
-
-        // XCheckTypedEvent is used instead of XIfEvent in order not to lock
-        // other threads out from the display during the entire wait period
-        while (!XCheckTypedEvent(_glfw.x11.display, SelectionNotify, &event))
-            selectDisplayConnection(NULL);
+        // XCheckIfEvent is used instead of XIfEvent in order not to lock
+        // other threads out from the display during the entire wait
+        if (XCheckIfEvent(_glfw.x11.display,
+                          &event,
+                          isClipboardEvent,
+                          (XPointer) window))
+        {
+            if (event.type == SelectionNotify)
+                handleClipboardNotify(window, &event.xselection);
+            else
+                handleClipboardChunk(window, &event.xproperty);
 
-        if (event.xselection.property == None)
             continue;
-
-        if (_glfwGetWindowProperty(event.xselection.requestor,
-                                   event.xselection.property,
-                                   event.xselection.target,
-                                   (unsigned char**) &data))
-        {
-            _glfw.x11.clipboardString = strdup(data);
         }
 
-        XFree(data);
-
-        XDeleteProperty(_glfw.x11.display,
-                        event.xselection.requestor,
-                        event.xselection.property);
+        if (window->x11.clipboard.deadline)
+        {
+            struct timeval timeout;
+            const double remaining = window->x11.clipboard.deadline -
+                                     _glfwPlatformGetTime();
 
-        if (_glfw.x11.clipboardString)
-            break;
-    }
+            if (remaining <= 0.0)
+            {
+                checkClipboardTimeout(window);
+                break;
+            }
 
-    if (_glfw.x11.clipboardString == NULL)
-    {
-        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
-                        "X11: Failed to convert clipboard to string");
+            timeout.tv_sec = (long) remaining;
+            timeout.tv_usec = (long) ((remaining - timeout.tv_sec) * 1e6);
+            selectDisplayConnection(&timeout);
+        }
+        else
+            selectDisplayConnection(NULL);
     }
 
     return _glfw.x11.clipboardString;
 }
 
+void _glfwPlatformRequestClipboardString(_GLFWwindow* window)
+{
+    startClipboardRequest(window, GL_TRUE);
+}
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
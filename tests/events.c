@@ -29,6 +29,8 @@
 //
 // Every event also gets a (sequential) number to aid discussion of logs
 //
+// Window events are printed with the time the window system received them
+//
 //========================================================================
 
 #include <GLFW/glfw3.h>
@@ -269,21 +271,21 @@ static void window_pos_callback(GLFWwindow* window, int x, int y)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Window position: %i %i\n",
-           counter++, slot->number, glfwGetTime(), x, y);
+           counter++, slot->number, glfwGetEventTime(), x, y);
 }
 
 static void window_size_callback(GLFWwindow* window, int width, int height)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Window size: %i %i\n",
-           counter++, slot->number, glfwGetTime(), width, height);
+           counter++, slot->number, glfwGetEventTime(), width, height);
 }
 
 static void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Framebuffer size: %i %i\n",
-           counter++, slot->number, glfwGetTime(), width, height);
+           counter++, slot->number, glfwGetEventTime(), width, height);
 
     glViewport(0, 0, width, height);
 }
@@ -292,7 +294,7 @@ static void window_close_callback(GLFWwindow* window)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Window close\n",
-           counter++, slot->number, glfwGetTime());
+           counter++, slot->number, glfwGetEventTime());
 
     glfwSetWindowShouldClose(window, slot->closeable);
 }
@@ -301,7 +303,7 @@ static void window_refresh_callback(GLFWwindow* window)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Window refresh\n",
-           counter++, slot->number, glfwGetTime());
+           counter++, slot->number, glfwGetEventTime());
 
     glfwMakeContextCurrent(window);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -312,7 +314,7 @@ static void window_focus_callback(GLFWwindow* window, int focused)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Window %s\n",
-           counter++, slot->number, glfwGetTime(),
+           counter++, slot->number, glfwGetEventTime(),
            focused ? "focused" : "defocused");
 }
 
@@ -320,7 +322,7 @@ static void window_iconify_callback(GLFWwindow* window, int iconified)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Window was %s\n",
-           counter++, slot->number, glfwGetTime(),
+           counter++, slot->number, glfwGetEventTime(),
            iconified ? "iconified" : "restored");
 }
 
@@ -328,7 +330,7 @@ static void mouse_button_callback(GLFWwindow* window, int button, int action, in
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Mouse button %i (%s) (with%s) was %s\n",
-           counter++, slot->number, glfwGetTime(), button,
+           counter++, slot->number, glfwGetEventTime(), button,
            get_button_name(button),
            get_mods_name(mods),
            get_action_name(action));
@@ -338,14 +340,14 @@ static void cursor_position_callback(GLFWwindow* window, double x, double y)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Cursor position: %f %f\n",
-           counter++, slot->number, glfwGetTime(), x, y);
+           counter++, slot->number, glfwGetEventTime(), x, y);
 }
 
 static void cursor_enter_callback(GLFWwindow* window, int entered)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Cursor %s window\n",
-           counter++, slot->number, glfwGetTime(),
+           counter++, slot->number, glfwGetEventTime(),
            entered ? "entered" : "left");
 }
 
@@ -353,7 +355,7 @@ static void scroll_callback(GLFWwindow* window, double x, double y)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Scroll: %0.3f %0.3f\n",
-           counter++, slot->number, glfwGetTime(), x, y);
+           counter++, slot->number, glfwGetEventTime(), x, y);
 }
 
 static void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
@@ -361,7 +363,7 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
     Slot* slot = glfwGetWindowUserPointer(window);
 
     printf("%08x to %i at %0.3f: Key 0x%04x Scancode 0x%04x (%s) (with%s) was %s\n",
-           counter++, slot->number, glfwGetTime(), key, scancode,
+           counter++, slot->number, glfwGetEventTime(), key, scancode,
            get_key_name(key),
            get_mods_name(mods),
            get_action_name(action));
@@ -385,7 +387,7 @@ static void char_callback(GLFWwindow* window, unsigned int codepoint)
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Character 0x%08x (%s) input\n",
-           counter++, slot->number, glfwGetTime(), codepoint,
+           counter++, slot->number, glfwGetEventTime(), codepoint,
            get_character_string(codepoint));
 }
 
@@ -393,7 +395,7 @@ static void char_mods_callback(GLFWwindow* window, unsigned int codepoint, int m
 {
     Slot* slot = glfwGetWindowUserPointer(window);
     printf("%08x to %i at %0.3f: Character 0x%08x (%s) with modifiers (with%s) input\n",
-            counter++, slot->number, glfwGetTime(), codepoint,
+            counter++, slot->number, glfwGetEventTime(), codepoint,
             get_character_string(codepoint),
             get_mods_name(mods));
 }
@@ -404,7 +406,7 @@ static void drop_callback(GLFWwindow* window, int count, const char** paths)
     Slot* slot = glfwGetWindowUserPointer(window);
 
     printf("%08x to %i at %0.3f: Drop input\n",
-           counter++, slot->number, glfwGetTime());
+           counter++, slot->number, glfwGetEventTime());
 
     for (i = 0;  i < count;  i++)
         printf("  %i: \"%s\"\n", i, paths[i]);
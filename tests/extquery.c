@@ -0,0 +1,266 @@
+//========================================================================
+// Extension query benchmark
+// Copyright (c) Camilla Berglund <elmindreda@elmindreda.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test probes a set of present and absent extensions, both with
+// glfwExtensionSupported and with a direct search of the extension strings
+// of the context, and reports the time per query of each
+//
+// The direct search is how glfwExtensionSupported used to be implemented
+//
+//========================================================================
+
+#include <GLFW/glfw3.h>
+#include <GL/glext.h>
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+#define PROBE_COUNT 80
+
+static PFNGLGETSTRINGIPROC glGetStringi = NULL;
+static int modern = GL_FALSE;
+
+static const char* absent[] =
+{
+    "GL_GLFW_absent_extension_a",
+    "GL_GLFW_absent_extension_b",
+    "GL_GLFW_absent_extension_c",
+    "GL_GLFW_absent_extension_d",
+    // Made-up names sharing a prefix with real extensions
+    "GL_EXT_texture_glfw_absent",
+    "GL_ARB_glfw_absent"
+};
+
+static void usage(void)
+{
+    printf("Usage: extquery [-h] [-c] [-n ROUNDS]\n");
+    printf("Options:\n");
+    printf("  -c create an OpenGL 3.2 core profile context\n");
+    printf("  -n the number of times to probe every extension\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static int search_extension_string(const char* extension)
+{
+    const char* start = (const char*) glGetString(GL_EXTENSIONS);
+    const size_t length = strlen(extension);
+
+    for (;;)
+    {
+        const char* where = strstr(start, extension);
+        if (!where)
+            return GL_FALSE;
+
+        if ((where == start || where[-1] == ' ') &&
+            (where[length] == ' ' || where[length] == '\0'))
+        {
+            return GL_TRUE;
+        }
+
+        start = where + length;
+    }
+}
+
+static int search_extension_list(const char* extension)
+{
+    int i;
+    GLint count;
+
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+    for (i = 0;  i < count;  i++)
+    {
+        const char* name = (const char*) glGetStringi(GL_EXTENSIONS, i);
+        if (strcmp(name, extension) == 0)
+            return GL_TRUE;
+    }
+
+    return GL_FALSE;
+}
+
+static int search_directly(const char* extension)
+{
+    if (modern)
+        return search_extension_list(extension);
+    else
+        return search_extension_string(extension);
+}
+
+static int collect_probes(char** probes)
+{
+    int i, count = 0;
+    const int present = PROBE_COUNT - sizeof(absent) / sizeof(absent[0]);
+
+    if (modern)
+    {
+        GLint available;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &available);
+
+        for (i = 0;  i < available && count < present;  i++)
+            probes[count++] = strdup((const char*) glGetStringi(GL_EXTENSIONS, i));
+    }
+    else
+    {
+        const char* start = (const char*) glGetString(GL_EXTENSIONS);
+
+        while (*start && count < present)
+        {
+            const size_t length = strcspn(start, " ");
+
+            if (length)
+            {
+                probes[count] = calloc(length + 1, 1);
+                memcpy(probes[count], start, length);
+                count++;
+            }
+
+            start += length;
+            start += strspn(start, " ");
+        }
+    }
+
+    for (i = 0;  i < (int) (sizeof(absent) / sizeof(absent[0]));  i++)
+        probes[count++] = strdup(absent[i]);
+
+    return count;
+}
+
+static double run(int (*query)(const char*),
+                  char** probes, int count,
+                  unsigned long rounds,
+                  int* found)
+{
+    int i;
+    unsigned long round;
+    const double base = glfwGetTime();
+
+    *found = 0;
+
+    for (round = 0;  round < rounds;  round++)
+    {
+        for (i = 0;  i < count;  i++)
+        {
+            if (query(probes[i]))
+                (*found)++;
+        }
+    }
+
+    return glfwGetTime() - base;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, i, count, hashedFound, directFound, core = GL_FALSE;
+    unsigned long rounds = 1000;
+    double hashed, direct;
+    char* probes[PROBE_COUNT];
+    GLFWwindow* window;
+
+    while ((ch = getopt(argc, argv, "chn:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'c':
+                core = GL_TRUE;
+                break;
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'n':
+                rounds = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!rounds)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+
+    if (core)
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+    }
+
+    window = glfwCreateWindow(200, 200, "Extension Query", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwMakeContextCurrent(window);
+
+    if (glfwGetWindowAttrib(window, GLFW_CONTEXT_VERSION_MAJOR) > 2)
+    {
+        glGetStringi = (PFNGLGETSTRINGIPROC) glfwGetProcAddress("glGetStringi");
+        if (!glGetStringi)
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        modern = GL_TRUE;
+    }
+
+    count = collect_probes(probes);
+
+    hashed = run(glfwExtensionSupported, probes, count, rounds, &hashedFound);
+    direct = run(search_directly, probes, count, rounds, &directFound);
+
+    printf("Probed %i extensions %lu times using the %s\n",
+           count, rounds, modern ? "extension list" : "extension string");
+    printf("glfwExtensionSupported: %0.1f ns per query (%i found)\n",
+           hashed * 1e9 / (count * rounds), hashedFound);
+    printf("Direct search: %0.1f ns per query (%i found)\n",
+           direct * 1e9 / (count * rounds), directFound);
+
+    for (i = 0;  i < count;  i++)
+        free(probes[i]);
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,209 @@
+//========================================================================
+// Event throughput benchmark
+// Copyright (c) Camilla Berglund <elmindreda@elmindreda.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test floods its own window with synthetic pointer motion or key press
+// events and reports how many of them GLFW can process per second
+//
+// Key presses are translated to characters without an input method when none
+// is available, which measures the per-keystroke translation cost
+//
+// It does not need a window manager and can be run under Xvfb
+//
+//========================================================================
+
+#include <GLFW/glfw3.h>
+
+#define GLFW_EXPOSE_NATIVE_X11
+#include <GLFW/glfw3native.h>
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static unsigned long received = 0;
+
+static void usage(void)
+{
+    printf("Usage: flood [-h] [-k] [-n COUNT] [-b BATCH]\n");
+    printf("Options:\n");
+    printf("  -k send key presses instead of pointer motion\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void cursor_position_callback(GLFWwindow* window, double x, double y)
+{
+    received++;
+}
+
+static void char_callback(GLFWwindow* window, unsigned int codepoint)
+{
+    received++;
+}
+
+static void send_key(Display* display, Window handle, KeyCode keycode)
+{
+    XEvent event;
+
+    memset(&event, 0, sizeof(event));
+    event.type = KeyPress;
+    event.xkey.display = display;
+    event.xkey.window = handle;
+    event.xkey.root = DefaultRootWindow(display);
+    event.xkey.keycode = keycode;
+    event.xkey.same_screen = True;
+
+    XSendEvent(display, handle, False, 0, &event);
+}
+
+static void send_motion(Display* display, Window handle, int x, int y)
+{
+    XEvent event;
+
+    memset(&event, 0, sizeof(event));
+    event.type = MotionNotify;
+    event.xmotion.display = display;
+    event.xmotion.window = handle;
+    event.xmotion.root = DefaultRootWindow(display);
+    event.xmotion.x = x;
+    event.xmotion.y = y;
+    event.xmotion.same_screen = True;
+
+    XSendEvent(display, handle, False, 0, &event);
+}
+
+int main(int argc, char** argv)
+{
+    int ch, keys = GL_FALSE;
+    unsigned long i, sent = 0, count = 1000000, batch = 1000;
+    double base, elapsed;
+    Display* display;
+    Window handle;
+    GLFWwindow* window;
+    const char* symbols = "abcdefghijklmnopqrstuvwxyz0123456789";
+    KeyCode keycodes[36];
+    const unsigned long keycodeCount = sizeof(keycodes) / sizeof(keycodes[0]);
+
+    while ((ch = getopt(argc, argv, "hkn:b:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'k':
+                keys = GL_TRUE;
+                break;
+            case 'n':
+                count = strtoul(optarg, NULL, 10);
+                break;
+            case 'b':
+                batch = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!count || !batch)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+
+    window = glfwCreateWindow(200, 200, "Event Flood", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    display = glfwGetX11Display();
+    handle = glfwGetX11Window(window);
+
+    if (keys)
+    {
+        for (i = 0;  i < keycodeCount;  i++)
+        {
+            const char symbol[2] = { symbols[i], '\0' };
+            keycodes[i] = XKeysymToKeycode(display, XStringToKeysym(symbol));
+            if (!keycodes[i])
+            {
+                fprintf(stderr, "No key code for %s in the current layout\n", symbol);
+                glfwTerminate();
+                exit(EXIT_FAILURE);
+            }
+        }
+
+        glfwSetCharCallback(window, char_callback);
+    }
+    else
+        glfwSetCursorPosCallback(window, cursor_position_callback);
+
+    // Let any events from window creation settle before starting the clock
+    glfwPollEvents();
+    received = 0;
+
+    base = glfwGetTime();
+
+    while (sent < count)
+    {
+        const unsigned long target = sent + batch < count ? sent + batch : count;
+
+        for (i = sent;  i < target;  i++)
+        {
+            if (keys)
+                send_key(display, handle, keycodes[i % keycodeCount]);
+            else
+                send_motion(display, handle, 1 + (int) (i % 100), 1 + (int) (i / 100 % 100));
+        }
+
+        sent = target;
+
+        while (received < sent)
+            glfwPollEvents();
+    }
+
+    elapsed = glfwGetTime() - base;
+
+    printf("Processed %lu %s events in %0.3f seconds (%0.0f events/s)\n",
+           received, keys ? "key press" : "motion", elapsed, received / elapsed);
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,220 @@
+//========================================================================
+// Large clipboard transfer test
+// Copyright (c) Camilla Berglund <elmindreda@elmindreda.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test forks into two processes, each with its own GLFW instance and
+// connection to the X server.  The parent puts a large string on the
+// clipboard and the child reads it back and verifies it, which exercises
+// incremental (INCR) selection transfers in both directions
+//
+// It does not need a window manager and can be run under Xvfb
+//
+//========================================================================
+
+#include <GLFW/glfw3.h>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static void usage(void)
+{
+    printf("Usage: incr [-h] [-s MEGABYTES]\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static char* create_payload(size_t size)
+{
+    size_t i;
+    char* payload = malloc(size + 1);
+    if (!payload)
+        return NULL;
+
+    // A pattern that does not repeat at any power of two catches both
+    // dropped and reordered chunks
+    for (i = 0;  i < size;  i++)
+        payload[i] = 'a' + (char) ((i + i / 4099) % 26);
+
+    payload[size] = '\0';
+    return payload;
+}
+
+static GLFWwindow* create_window(void)
+{
+    GLFWwindow* window;
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+
+    window = glfwCreateWindow(200, 200, "Large Clipboard Transfer", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    return window;
+}
+
+static int receive(int fd, const char* payload, size_t size)
+{
+    char ready;
+    double base, elapsed;
+    const char* string;
+    GLFWwindow* window;
+
+    // Wait for the parent to take ownership of the clipboard
+    if (read(fd, &ready, 1) != 1)
+        return EXIT_FAILURE;
+
+    window = create_window();
+
+    base = glfwGetTime();
+    string = glfwGetClipboardString(window);
+    elapsed = glfwGetTime() - base;
+
+    if (!string)
+    {
+        fprintf(stderr, "Failed to retrieve clipboard contents\n");
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    if (strlen(string) != size || memcmp(string, payload, size) != 0)
+    {
+        fprintf(stderr, "Received %lu bytes that do not match the %lu sent\n",
+                (unsigned long) strlen(string), (unsigned long) size);
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    printf("Received %lu bytes in %0.3f seconds (%0.1f MB/s)\n",
+           (unsigned long) size, elapsed, size / elapsed / (1024.0 * 1024.0));
+
+    glfwTerminate();
+    return EXIT_SUCCESS;
+}
+
+static int send_payload(int fd, pid_t child, const char* payload)
+{
+    int status;
+    pid_t result;
+    GLFWwindow* window = create_window();
+
+    glfwSetClipboardString(window, payload);
+
+    if (write(fd, "", 1) != 1)
+    {
+        glfwTerminate();
+        return EXIT_FAILURE;
+    }
+
+    // Serve the clipboard until the child has read it
+    while ((result = waitpid(child, &status, WNOHANG)) == 0)
+        glfwWaitEventsTimeout(0.1);
+
+    glfwTerminate();
+
+    if (result == child && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS)
+        return EXIT_SUCCESS;
+
+    return EXIT_FAILURE;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, fds[2], result;
+    unsigned long megabytes = 64;
+    size_t size;
+    char* payload;
+    pid_t child;
+
+    while ((ch = getopt(argc, argv, "hs:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 's':
+                megabytes = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!megabytes)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    size = (size_t) megabytes * 1024 * 1024;
+    payload = create_payload(size);
+    if (!payload)
+        exit(EXIT_FAILURE);
+
+    if (pipe(fds) != 0)
+        exit(EXIT_FAILURE);
+
+    // Fork before initializing GLFW so each process gets its own connection
+    child = fork();
+    if (child == -1)
+        exit(EXIT_FAILURE);
+
+    if (child == 0)
+    {
+        close(fds[1]);
+        result = receive(fds[0], payload, size);
+    }
+    else
+    {
+        close(fds[0]);
+        result = send_payload(fds[1], child, payload);
+
+        if (result == EXIT_SUCCESS)
+            printf("Clipboard transfer succeeded\n");
+        else
+            printf("Clipboard transfer failed\n");
+    }
+
+    free(payload);
+    exit(result);
+}
@@ -0,0 +1,146 @@
+//========================================================================
+// Function loading benchmark
+// Copyright (c) Camilla Berglund <elmindreda@elmindreda.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test creates a number of contexts and loads every function known to
+// glad for each of them, both one at a time with glfwGetProcAddress and in
+// bulk with glfwGetProcAddresses, and reports the time taken by each
+//
+//========================================================================
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+#define MAX_NAMES 8192
+
+static const char* names[MAX_NAMES];
+static GLFWglproc procs[MAX_NAMES];
+static int name_count = 0;
+
+static void usage(void)
+{
+    printf("Usage: procload [-h] [-n CONTEXTS]\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void* record_name(const char* name)
+{
+    if (name_count < MAX_NAMES)
+        names[name_count++] = name;
+
+    return (void*) glfwGetProcAddress(name);
+}
+
+static GLFWwindow* create_context(void)
+{
+    GLFWwindow* window = glfwCreateWindow(1, 1, "Function Loading", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwMakeContextCurrent(window);
+    return window;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, i, found = 0;
+    unsigned long count = 10;
+    double base, first, single = 0.0, bulk = 0.0;
+    GLFWwindow* window;
+
+    while ((ch = getopt(argc, argv, "hn:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+            case 'n':
+                count = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!count)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+
+    // The first load records the names of every function glad knows about
+
+    window = create_context();
+
+    base = glfwGetTime();
+    gladLoadGLLoader(record_name);
+    first = glfwGetTime() - base;
+
+    glfwDestroyWindow(window);
+
+    for (i = 0;  i < (int) count;  i++)
+    {
+        window = create_context();
+
+        base = glfwGetTime();
+        gladLoadGLLoader((GLADloadproc) glfwGetProcAddress);
+        single += glfwGetTime() - base;
+
+        base = glfwGetTime();
+        found = glfwGetProcAddresses(names, procs, name_count);
+        bulk += glfwGetTime() - base;
+
+        glfwDestroyWindow(window);
+    }
+
+    printf("Loaded %i functions (%i found) for %lu contexts\n",
+           name_count, found, count);
+    printf("First load: %0.3f ms\n", first * 1e3);
+    printf("glfwGetProcAddress: %0.3f ms per context\n", single * 1e3 / count);
+    printf("glfwGetProcAddresses: %0.3f ms per context\n", bulk * 1e3 / count);
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
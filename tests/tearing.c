@@ -26,6 +26,9 @@
 // This test renders a high contrast, horizontally moving bar, allowing for
 // visual verification of whether the set swap interval is indeed obeyed
 //
+// It can also pace frames with glfwWaitForFrame and report the resulting
+// frame time jitter, optionally exiting after a set number of frames
+//
 //========================================================================
 
 #include <GLFW/glfw3.h>
@@ -39,27 +42,79 @@
 static GLboolean swap_tear;
 static int swap_interval;
 static double frame_rate;
+static GLboolean pacing = GL_FALSE;
+static double render_budget = 0.004;
 
 static void usage(void)
 {
-    printf("Usage: iconify [-h] [-f]\n");
+    printf("Usage: tearing [-h] [-f] [-p MS] [-n FRAMES]\n");
     printf("Options:\n");
     printf("  -f create full screen window\n");
     printf("  -h show this help\n");
+    printf("  -p pace frames with the specified render budget in milliseconds\n");
+    printf("  -n exit after the specified number of frames and print statistics\n");
 }
 
 static void update_window_title(GLFWwindow* window)
 {
     char title[256];
 
-    sprintf(title, "Tearing detector (interval %i%s, %0.1f Hz)",
-            swap_interval,
-            (swap_tear && swap_interval < 0) ? " (swap tear)" : "",
-            frame_rate);
+    if (pacing)
+    {
+        GLFWframestats stats;
+        glfwGetFrameStatistics(window, &stats);
+
+        sprintf(title, "Tearing detector (interval %i%s, %0.1f Hz, "
+                       "paced %0.1f ms, jitter %0.3f ms, %i missed)",
+                swap_interval,
+                (swap_tear && swap_interval < 0) ? " (swap tear)" : "",
+                frame_rate,
+                render_budget * 1e3,
+                stats.frameTimeDeviation * 1e3,
+                stats.missedDeadlines);
+    }
+    else
+    {
+        sprintf(title, "Tearing detector (interval %i%s, %0.1f Hz)",
+                swap_interval,
+                (swap_tear && swap_interval < 0) ? " (swap tear)" : "",
+                frame_rate);
+    }
 
     glfwSetWindowTitle(window, title);
 }
 
+static void print_statistics(GLFWwindow* window, unsigned long frames)
+{
+    GLFWframestats stats;
+    GLFWframetiming timing;
+
+    glfwGetFrameStatistics(window, &stats);
+
+    printf("Paced %lu frames with a render budget of %0.3f ms\n",
+           frames, render_budget * 1e3);
+    printf("Frame time: mean %0.3f ms, min %0.3f ms, max %0.3f ms\n",
+           stats.meanFrameTime * 1e3,
+           stats.minFrameTime * 1e3,
+           stats.maxFrameTime * 1e3);
+    printf("Jitter: %0.3f ms standard deviation\n",
+           stats.frameTimeDeviation * 1e3);
+    printf("Wake latency: mean %0.3f ms, max %0.3f ms\n",
+           stats.meanWakeLatency * 1e3,
+           stats.maxWakeLatency * 1e3);
+    printf("Missed deadlines: %i\n", stats.missedDeadlines);
+
+    if (glfwGetFrameTiming(window, &timing))
+    {
+        printf("Presented swaps: %llu, missed retraces: %i, refresh %0.3f ms\n",
+               (unsigned long long) timing.sbc,
+               timing.missedFrames,
+               timing.refreshPeriod * 1e3);
+    }
+    else
+        printf("Frame timing is not available\n");
+}
+
 static void set_swap_interval(GLFWwindow* window, int interval)
 {
     swap_interval = interval;
@@ -106,6 +161,14 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
             break;
         }
 
+        case GLFW_KEY_P:
+        {
+            pacing = !pacing;
+            glfwResetFrameStatistics(window);
+            update_window_title(window);
+            break;
+        }
+
         case GLFW_KEY_ESCAPE:
             glfwSetWindowShouldClose(window, 1);
             break;
@@ -116,13 +179,13 @@ int main(int argc, char** argv)
 {
     int ch, width, height;
     float position;
-    unsigned long frame_count = 0;
+    unsigned long frame_count = 0, total_frames = 0, frame_limit = 0;
     double last_time, current_time;
     GLboolean fullscreen = GL_FALSE;
     GLFWmonitor* monitor = NULL;
     GLFWwindow* window;
 
-    while ((ch = getopt(argc, argv, "fh")) != -1)
+    while ((ch = getopt(argc, argv, "fhp:n:")) != -1)
     {
         switch (ch)
         {
@@ -133,9 +196,28 @@ int main(int argc, char** argv)
             case 'f':
                 fullscreen = GL_TRUE;
                 break;
+
+            case 'p':
+                pacing = GL_TRUE;
+                render_budget = atof(optarg) / 1e3;
+                break;
+
+            case 'n':
+                frame_limit = strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
         }
     }
 
+    if (render_budget < 0.0)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
     glfwSetErrorCallback(error_callback);
 
     if (!glfwInit())
@@ -186,6 +268,10 @@ int main(int argc, char** argv)
 
     while (!glfwWindowShouldClose(window))
     {
+        // Sample the animation time as late as the render budget allows
+        if (pacing)
+            glfwWaitForFrame(window, render_budget);
+
         glClear(GL_COLOR_BUFFER_BIT);
 
         position = cosf((float) glfwGetTime() * 4.f) * 0.75f;
@@ -195,6 +281,10 @@ int main(int argc, char** argv)
         glfwPollEvents();
 
         frame_count++;
+        total_frames++;
+
+        if (frame_limit && total_frames >= frame_limit)
+            break;
 
         current_time = glfwGetTime();
         if (current_time - last_time > 1.0)
@@ -206,6 +296,9 @@ int main(int argc, char** argv)
         }
     }
 
+    if (pacing)
+        print_statistics(window, total_frames);
+
     glfwTerminate();
     exit(EXIT_SUCCESS);
 }